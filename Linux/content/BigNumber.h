@@ -32,6 +32,7 @@
 #pragma once
 #include <vector>
 #include <string>		//	for string
+#include <utility>		//	for std::move
 #include <stddef.h>  	// size_t definition
 
 /**
@@ -43,9 +44,28 @@
  *   #5-7 = build
  *
  *   0.3.001 - 2017-07-25 made some changes to make sure that it builds with gcc
+ *   0.4.001 - 2026-10-17 the numbers are kept in limbs of 9 digits rather than one digit per byte
+ *   0.4.002 - 2026-10-17 small numbers are kept inline and use native 64 bit arithmetic
+ *   0.4.003 - 2026-10-17 Karatsuba and Toom-3 multiplications for big numbers
+ *   0.4.004 - 2026-10-17 short division by small numbers and DivMod( ... )
+ *   0.4.005 - 2026-10-17 move constructor/assignment and in place Add/Sub/Mul
+ *   0.4.006 - 2026-10-17 the limbs keep free space in front so shifting by the base does not move them
+ *   0.4.007 - 2026-10-17 Knuth and Newton divisions for big numbers
+ *   0.4.008 - 2026-10-17 divide and conquer conversion to other bases
+ *   0.4.009 - 2026-10-17 binary splitting Factorial( ... ) and ProductRange( ... )
+ *   0.4.010 - 2026-10-17 e( ... ) and pi( ... ) to any precision
+ *   0.4.011 - 2026-10-17 argument reduction for Exp( ... ), Halley's method for Ln( ... )
+ *   0.4.012 - 2026-10-17 thread safe constants, without a lock once they are created
+ *   0.4.013 - 2026-10-17 BigNumber::Arena to allocate the limbs from
+ *   0.4.014 - 2026-10-17 4 inline limbs, (36 numbers), before we allocate
+ *   0.4.015 - 2026-10-17 SSE2/AVX2 add, subtract and compare of the limbs
+ *   0.4.016 - 2026-10-17 Parse( const char* ) reads the numbers 16, (or 8), at a time
+ *   0.4.017 - 2026-10-17 BigInt, whole numbers >= 0 without decimals, sign or NaN
+ *   0.4.018 - 2026-10-17 MulAdd( ... ), DivModInteger( ... ) and ShiftDigits( ... )
+ *   0.4.019 - 2026-10-17 AppendTo( ... ) and WriteDigits( ... ), write the number without allocating
  */
-#define BIGNUMBER_VERSION        "0.3.001"
-#define BIGNUMBER_VERSION_NUMBER  0003001
+#define BIGNUMBER_VERSION        "0.4.019"
+#define BIGNUMBER_VERSION_NUMBER  0004019
 
  /**
   * this is a base 10 class, but we use this to prevent
@@ -53,6 +73,59 @@
   */
 #define BIGNUMBER_BASE           ((const unsigned short)10)
 
+ /**
+  * the numbers are stored in 'limbs' of BIGNUMBER_LIMB_DIGITS digits
+  * so we only do one operation for 9 numbers rather than one per number.
+  * 999999999 * 999999999 + carry still fits in an unsigned long long.
+  */
+#define BIGNUMBER_LIMB_BASE      ((unsigned int)1000000000)
+#define BIGNUMBER_LIMB_DIGITS    ((size_t)9)
+
+ /**
+  * the number of limbs kept inside the number itself before we allocate memory.
+  * 4 limbs is anything up to 36 numbers, so everything that fits in a 64 bit integer
+  * and most numbers with a few decimals, (or the product of 2 of them), never allocate.
+  */
+#define BIGNUMBER_INLINE_LIMBS   ((size_t)4)
+
+ /**
+  * the default number of limbs in each block of a BigNumber::Arena, (64K).
+  * limbs that need more than that get their own block.
+  */
+#define BIGNUMBER_ARENA_LIMBS    ((size_t)16384)
+
+ /**
+  * The number of limbs, (of the smallest number), where we change multiplication algorithm
+  * below BIGNUMBER_KARATSUBA_LIMBS we use the long multiplication
+  * then Karatsuba up to BIGNUMBER_TOOM3_LIMBS and Toom-3 after that.
+  * Like BIGNUMBER_NEWTON_LIMBS below, they were tuned on one machine, (an x86-64 Xeon, g++ 12 -O2, one thread),
+  * with BigNumberBench.cpp, build it again with other values, (-D...), to check them on another one.
+  * Other CPUs and compilers can be better off with other values, the results are the same whatever they are.
+  */
+#ifndef BIGNUMBER_KARATSUBA_LIMBS
+#define BIGNUMBER_KARATSUBA_LIMBS ((size_t)40)
+#endif
+#ifndef BIGNUMBER_TOOM3_LIMBS
+#define BIGNUMBER_TOOM3_LIMBS     ((size_t)300)
+#endif
+
+ /**
+  * The number of limbs of the denominator where we change division algorithm
+  * below BIGNUMBER_NEWTON_LIMBS, (or if the quotient is less than a third of that), we use Knuth's long division
+  * after that we multiply by the reciprocal of the denominator.
+  * It cannot be less than 8, the reciprocal starts from the one of a top half that has to be smaller than the number.
+  * @see BIGNUMBER_KARATSUBA_LIMBS about how it was tuned.
+  */
+#ifndef BIGNUMBER_NEWTON_LIMBS
+#define BIGNUMBER_NEWTON_LIMBS    ((size_t)150)
+#endif
+
+ /**
+  * The number of limbs where we start using the vector instructions, (SSE2 or AVX2), to add, subtract and compare
+  * below that the scalar loop is just as fast.
+  */
+#define BIGNUMBER_SIMD_LIMBS      ((size_t)16)
+
   /**
    * The precision we want to stop at, by default.
    * so we  don't divide for ever and ever...
@@ -68,12 +141,121 @@
 
 namespace MyOddWeb
 {
+    class BigInt;
+
     class BigNumber
     {
+        // BigInt uses the same limbs and the same functions to add, multiply and so on.
+        friend class BigInt;
+
     protected:
-        // the numbers.
+        // the numbers, one per item.
         typedef std::vector<unsigned char> NUMBERS;
 
+        // a block of memory in an arena, it is freed when the arena and all the limbs in it are done with it.
+        // @see Arena
+        class ArenaBlock;
+
+        // the numbers, BIGNUMBER_LIMB_DIGITS per item.
+        // the first BIGNUMBER_INLINE_LIMBS limbs are kept in the class itself
+        // so small numbers, (nearly all of them), never need to allocate any memory.
+        class LIMBS
+        {
+        public:
+            typedef unsigned int* iterator;
+            typedef const unsigned int* const_iterator;
+
+            LIMBS() : _data(_inline), _size(0), _capacity(BIGNUMBER_INLINE_LIMBS), _head(0), _block(NULL) {}
+            LIMBS(const LIMBS& rhs) : _data(_inline), _size(0), _capacity(BIGNUMBER_INLINE_LIMBS), _head(0), _block(NULL) { *this = rhs; }
+            LIMBS(LIMBS&& rhs) : _data(_inline), _size(0), _capacity(BIGNUMBER_INLINE_LIMBS), _head(0), _block(NULL) { *this = std::move(rhs); }
+            ~LIMBS() { _free(); }
+            LIMBS& operator=(const LIMBS& rhs);
+            LIMBS& operator=(LIMBS&& rhs);
+
+            size_t size() const { return _size; }
+            bool empty() const { return _size == 0; }
+            unsigned int& operator[](size_t index) { return _data[index]; }
+            const unsigned int& operator[](size_t index) const { return _data[index]; }
+            unsigned int& back() { return _data[_size - 1]; }
+            const unsigned int& back() const { return _data[_size - 1]; }
+            iterator begin() { return _data; }
+            iterator end() { return _data + _size; }
+            const_iterator begin() const { return _data; }
+            const_iterator end() const { return _data + _size; }
+
+            void push_back(unsigned int value) { if (_size == _capacity) { reserve(_capacity * 2); } _data[_size++] = value; }
+            void pop_back() { --_size; }
+            void clear() { _data -= _head; _capacity += _head; _head = 0; _size = 0; }
+            void reserve(size_t capacity);
+            void resize(size_t size, unsigned int value = 0);
+            void assign(size_t size, unsigned int value);
+            iterator insert(iterator position, size_t count, unsigned int value);
+            iterator erase(iterator first, iterator last);
+
+        private:
+            // the memory we allocated, (or the inline limbs), _data points _head limbs into it.
+            unsigned int* _memory() const { return _data - _head; }
+
+            // free the memory we allocated, if any.
+            void _free();
+
+            // the first limb, the limbs can start after the beginning of the memory
+            // so removing limbs from the front, (dividing by the base), does not move the others.
+            unsigned int* _data;
+            size_t _size;
+
+            // the number of limbs we can hold starting from _data.
+            size_t _capacity;
+
+            // the number of free limbs in front of _data.
+            size_t _head;
+
+            // the arena block the memory is from, or NULL if it is from the heap.
+            ArenaBlock* _block;
+            unsigned int _inline[BIGNUMBER_INLINE_LIMBS];
+        };
+
+    public:
+        /**
+         * While an arena exists, the limbs of the numbers on this thread are allocated from it
+         * by moving a pointer along a block of memory, and freeing them is just counting them out.
+         * When a block is full the arena reuses one of its blocks whose limbs have all been freed, or adds a new one.
+         * A block is freed in one go once the arena is reset or destroyed and the last limbs in it are freed,
+         * so numbers can safely outlive the arena.
+         * Arenas are per thread and can be nested, the last one created is the one used.
+         * The constants, (e, pi ...), are never allocated from an arena as they are kept forever.
+         * It pays off for a run of conversions or series, (Exp, Ln, ToBase ...),
+         * a loop that only creates a few numbers gains nothing from it.
+         *   {
+         *     BigNumber::Arena arena;
+         *     ... a conversion or a series ...
+         *   }
+         */
+        class Arena
+        {
+        public:
+            explicit Arena(size_t limbs = BIGNUMBER_ARENA_LIMBS);
+            ~Arena();
+            void Reset();
+
+        private:
+            Arena(const Arena&) = delete;
+            Arena& operator=(const Arena&) = delete;
+            friend class LIMBS;
+
+            unsigned int* _allocate(size_t count, ArenaBlock*& block);
+            ArenaBlock* _NextBlock(size_t count);
+
+            // the arena that was in use on this thread before this one.
+            Arena* _previous;
+
+            // the block we are allocating from, followed by all the other blocks of the arena.
+            ArenaBlock* _block;
+
+            // the number of limbs of each block.
+            size_t _limbs;
+        };
+
     public:
         BigNumber();
         BigNumber(const char* source);
@@ -82,7 +264,9 @@ namespace MyOddWeb
         BigNumber(double source);
         BigNumber(long double source);
         BigNumber(const BigNumber& source);
+        BigNumber(BigNumber&& source);
         BigNumber& operator=(const BigNumber& rhs);
+        BigNumber& operator=(BigNumber&& rhs);
 
     protected:
         // construct a number from an array of numbers.
@@ -104,8 +288,16 @@ namespace MyOddWeb
         BigNumber& Exp(size_t precision = BIGNUMBER_DEFAULT_PRECISION);
         BigNumber& Log(const BigNumber& base, size_t precision = BIGNUMBER_DEFAULT_PRECISION);
         BigNumber& Factorial(size_t precision = BIGNUMBER_DEFAULT_PRECISION);
+        static BigNumber ProductRange(unsigned long long first, unsigned long long last);
         BigNumber Mod(const BigNumber& denominator) const;
         BigNumber Quotient(const BigNumber& denominator) const;
+        void DivMod(const BigNumber& denominator, BigNumber& quotient, BigNumber& remainder) const;
+
+        //
+        // fused operations, (without the numbers in between).
+        BigNumber& MulAdd(const BigNumber& multiplier, const BigNumber& addend, size_t precision = BIGNUMBER_DEFAULT_PRECISION);
+        BigNumber& DivModInteger(const BigNumber& divisor, BigNumber& remainder);
+        BigNumber& ShiftDigits(int digits);
 
         //
         // Basic Trigonometric Functions
@@ -130,6 +322,8 @@ namespace MyOddWeb
         // Constants
         static const BigNumber& e();
         static const BigNumber& pi();
+        static BigNumber e(size_t precision);
+        static BigNumber pi(size_t precision);
 
         //
         // Helper
@@ -157,6 +351,11 @@ namespace MyOddWeb
         std::string ToString() const;
         std::string ToBase(unsigned short base, size_t precision = BIGNUMBER_DEFAULT_PRECISION) const;
 
+        // the same as ToString(), but in a buffer we are given.
+        size_t ToStringLength() const;
+        char* AppendTo(char* buffer) const;
+        size_t WriteDigits(char* buffer, size_t size) const;
+
     protected:
         static BigNumber AbsDiv(const BigNumber& lhs, const BigNumber& rhs, size_t precision);
         static BigNumber AbsAdd(const BigNumber& lhs, const BigNumber& rhs);
@@ -165,6 +364,11 @@ namespace MyOddWeb
         static BigNumber AbsPow(const BigNumber& base, const BigNumber& exp, size_t precision);
         static int AbsCompare(const BigNumber& lhs, const BigNumber& rhs); //  greater or equal
 
+        // the same as the Abs functions above, but the result is saved in this number.
+        void AbsAddAssign(const BigNumber& rhs);
+        void AbsSubAssign(const BigNumber& rhs);
+        void AbsMulAssign(const BigNumber& rhs, size_t precision);
+
     protected:
         static void QuotientAndRemainder(const BigNumber& numerator, const BigNumber& denominator, BigNumber& quotient, BigNumber& remainder);
         static void AbsQuotientAndRemainder(const BigNumber& numerator, const BigNumber& denominator, BigNumber& quotient, BigNumber& remainder);
@@ -174,8 +378,10 @@ namespace MyOddWeb
         void Parse(long long source);
         void Parse(long double source);
 
-        // the numbers in a vector.
-        NUMBERS _numbers;
+        // the numbers in a vector, in base BIGNUMBER_LIMB_BASE, the lowest limb first.
+        // the actual number is _limbs / BIGNUMBER_BASE^_decimals
+        // so 1234.5 = [12345] with 1 decimal and zero is an empty vector.
+        LIMBS _limbs;
 
         // is it negative or not?
         bool _neg;
@@ -215,16 +421,119 @@ namespace MyOddWeb
         BigNumber& RootNewton(const BigNumber& nthroot, size_t precision);
 
     protected:
-        unsigned long long _MakeNumberAtIndex(size_t index, size_t length) const;
-
-        unsigned char _At(size_t position, size_t expectedDecimals) const;
-
-        static bool _RecalcDenominator(BigNumber& max_denominator, BigNumber& base_multiplier, const BigNumber& remainder);
-
-        static BigNumber _NormalizeAngle(const BigNumber& radian);
+        unsigned char _At(size_t position) const;
+
+        const LIMBS& _AlignedLimbs(size_t decimals, LIMBS& buffer) const;
+
+        void _ToNumbers(NUMBERS& numbers) const;
+
+        static void _NumbersToLimbs(const NUMBERS& numbers, LIMBS& limbs);
+        static size_t _DigitsRun(const char* source, size_t length);
+        static void _DigitsToLimbs(const char* digits, size_t count, LIMBS& limbs);
+        static int _CompareLimbs(const LIMBS& lhs, const LIMBS& rhs);
+        static int _CompareLimbsKernel(const unsigned int* lhs, const unsigned int* rhs, size_t count);
+        static unsigned int _AddLimbsKernel(unsigned int* result, const unsigned int* lhs, const unsigned int* rhs, size_t count, unsigned int carry);
+        static unsigned int _SubLimbsKernel(unsigned int* result, const unsigned int* lhs, const unsigned int* rhs, size_t count, unsigned int borrow);
+        static void _AddLimbs(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result);
+        static void _SubLimbs(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result);
+        static void _AddLimbsAssign(LIMBS& lhs, const LIMBS& rhs);
+        static void _SubLimbsAssign(LIMBS& lhs, const LIMBS& rhs);
+        static void _MulLimbs(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result);
+        static void _MulLimbsSchoolbook(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result);
+        static void _MulLimbsKaratsuba(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result);
+        static void _MulLimbsToom3(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result);
+        static void _SliceLimbs(const LIMBS& limbs, size_t from, size_t count, LIMBS& part);
+        static void _AddLimbsAt(LIMBS& result, const LIMBS& number, size_t offset);
+        static unsigned int _DevideLimbs(LIMBS& limbs, unsigned int divisor);
+        static void _MulAddLimbs(LIMBS& limbs, unsigned int multiplier, const LIMBS& addend);
+        static void _DivModLimbs(const LIMBS& numerator, const LIMBS& denominator, LIMBS& quotient, LIMBS* remainder);
+        static void _DivModLimbsKnuth(const LIMBS& numerator, const LIMBS& denominator, LIMBS& quotient, LIMBS* remainder);
+        static void _DivModLimbsNewton(const LIMBS& numerator, const LIMBS& denominator, LIMBS& quotient, LIMBS* remainder);
+        static void _ReciprocalLimbs(const LIMBS& limbs, LIMBS& reciprocal);
+        static void _MultiplyLimbsByBase(LIMBS& limbs, size_t multiplier);
+        static void _DevideLimbsByBase(LIMBS& limbs, size_t divisor);
+        static void _ModuloLimbsByBase(LIMBS& limbs, size_t divisor);
+        static size_t _TrailingZeros(const LIMBS& limbs, size_t max);
+        static bool _LimbsToULongLong(const LIMBS& limbs, unsigned long long& number);
+        static void _ULongLongToLimbs(unsigned long long number, LIMBS& limbs);
+        static size_t _LimbsDigits(const LIMBS& limbs);
+        static void _WriteLimbs(const LIMBS& limbs, size_t count, char* end);
+        static void _ProductRangeLimbs(unsigned long long first, unsigned long long last, LIMBS& product);
+
+        static BigNumber _NormalizeAngle(const BigNumber& radian, size_t precision);
+
+        static BigNumber _CalculateE(size_t precision);
+        static BigNumber _CalculatePi(size_t precision);
+        static BigNumber _CalculateTwoPi(size_t precision);
+        static void _SeriesE(unsigned long long first, unsigned long long last, BigNumber& p, BigNumber& q);
+        static void _SeriesPi(unsigned long long first, unsigned long long last, BigNumber& p, BigNumber& q, BigNumber& t);
+        static void _SqrtLimbs(const LIMBS& limbs, LIMBS& root);
 
         static std::string _ToString(const NUMBERS& numbers, size_t decimals, bool isNeg, size_t precision);
         static void _ConvertIntegerToBase(const BigNumber& givenNumber, NUMBERS& numbers, const unsigned short base);
         static void _ConvertFractionToBase(const BigNumber& givenNumber, NUMBERS& numbers, const unsigned short base, size_t precision);
+        static size_t _BasePowers(const LIMBS& limbs, const unsigned short base, std::vector<LIMBS>& powers);
+        static void _ConvertLimbsToBase(const LIMBS& limbs, const std::vector<LIMBS>& powers, size_t level, size_t digits, bool pad, const unsigned short base, NUMBERS& numbers);
+    };
+
+    /**
+     * A whole number greater or equal to zero, of any size.
+     * There are no decimals, no sign and no NaN to look after, so counting, (Add(1)),
+     * or cutting a range in parts, (Quotient( ... )), does not pay for any of them.
+     *   BigInt first("1000000000000000000000"), last = BigInt(first).Add(16383);
+     *   BigNumber number = last.ToBigNumber();
+     */
+    class BigInt
+    {
+    public:
+        BigInt();
+        BigInt(const char* source);
+        BigInt(unsigned long long source);
+        BigInt(int source);
+        explicit BigInt(const BigNumber& source);
+        BigInt(const BigInt& source) = default;
+        BigInt(BigInt&& source) = default;
+        BigInt& operator=(const BigInt& rhs) = default;
+        BigInt& operator=(BigInt&& rhs) = default;
+
+        //
+        // Math
+        BigInt& Add(const BigInt& rhs);
+        BigInt& Sub(const BigInt& rhs);
+        BigInt& Mul(const BigInt& rhs);
+        BigInt Quotient(const BigInt& denominator) const;
+        BigInt Mod(const BigInt& denominator) const;
+        void DivMod(const BigInt& denominator, BigInt& quotient, BigInt& remainder) const;
+
+        //
+        // Helper
+        int Compare(const BigInt& rhs) const;
+        bool IsZero() const;
+        bool IsOdd() const;
+        bool IsEven() const;
+        bool IsEqual(const BigInt& rhs) const;
+        bool IsUnequal(const BigInt& rhs) const;
+        bool IsGreater(const BigInt& rhs) const;
+        bool IsLess(const BigInt& rhs) const;
+        bool IsGreaterEqual(const BigInt& rhs) const;
+        bool IsLessEqual(const BigInt& rhs) const;
+
+        //
+        // conversion.
+        unsigned long long ToULongLong() const;
+        std::string ToString() const;
+        BigNumber ToBigNumber() const;
+
+        // the same as ToString(), but in a buffer we are given.
+        size_t ToStringLength() const;
+        char* AppendTo(char* buffer) const;
+        size_t WriteDigits(char* buffer, size_t size) const;
+
+    protected:
+        void Parse(const char* source);
+
+        // the numbers in base BIGNUMBER_LIMB_BASE, the lowest limb first, without leading zeros.
+        // zero is an empty vector.
+        BigNumber::LIMBS _limbs;
     };
 }// namespace MyOddWeb
\ No newline at end of file
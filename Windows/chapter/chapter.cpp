@@ -1,61 +1,236 @@
 #include<iostream>
 #include<fstream>
+#include<sstream>
 #include<string>
+#include<vector>
+#include<thread>
+#include<atomic>
 
 using namespace std;
 
 class Number
 {
 private:
-	char* number;
+	string number;
 public:	
-	Number(char*);
+	Number(const string&);
 	
 	void PlusOne(void);
 	string ConvString(void);
 };
 
-int main()
+// what to write for one book, from the command line or from one line of a batch file.
+struct Job
 {
-    ifstream ui;
-    ui.open("chapter.txt");
-    ofstream ux;
-
-    char *input = new char[200];
-    for(int a=0;200>a;a++) input[a] = '\0';
-    string filename, title;
-    
-
-    cout << "Please enter the beginning chapter: ";
-    cin >> input;
-    Number chapter(input);
-    while(getline(ui, title))
-    {
-        filename = "chapter" + chapter.ConvString() + ".xhtml";
-        ux.open(filename);
-
-        ux << "<?xml version=\"1.0\" encoding=\"utf-8\" standalone=\"no\"?>\n<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.1//EN\"\n  \"http://www.w3.org/TR/xhtml11/DTD/xhtml11.dtd\">\n\n<html xmlns=\"http://www.w3.org/1999/xhtml\">\n\n<head>\n  <title>chapter";
-        ux << chapter.ConvString() << "</title>\n  <link href=\"../Styles/style.css\" rel=\"stylesheet\" type=\"text/css\" />\n</head>\n\n<body>\n  <h1>";
-        ux << title << "</h1>\n\n  <p>(This article)</p>\n\n</body>\n</html>";
-
-        chapter.PlusOne();
-        ux.close();
-    }
-
-    return 0;
+	string begin, input = "chapter.txt", output, batch;
+	unsigned int jobs = 0;
+};
+
+bool Chapters(const Job&, string&);
+bool ReadArguments(const vector<string>&, Job&, string&);
+int RunBatch(const Job&);
+
+const char* const usage =
+	"Usage: chapter.exe --begin N [--input FILE] [--output DIR]\n"
+	"       chapter.exe --batch FILE [--jobs N]\n"
+	"Without arguments the beginning chapter is asked for, the titles are read from chapter.txt\n"
+	"and the chapter*.xhtml files are written in the current folder.\n"
+	"A batch file has the options of one book per line, (--begin, --input and --output),\n"
+	"empty lines and lines starting with # are skipped, the books run --jobs at a time.\n";
+
+int main(int argc, char* argv[])
+{
+	Job job;
+	string error;
+
+	if(argc == 1)
+	{
+		cout << "Please enter the beginning chapter: ";
+		cin >> job.begin;
+	}
+	else if(!ReadArguments(vector<string>(argv + 1, argv + argc), job, error))
+	{
+		if(error.empty())
+		{
+			cout << usage;
+			return 0;
+		}
+		cerr << "Error! " << error << "\n\n" << usage;
+		return 2;
+	}
+	if(!job.batch.empty()) return RunBatch(job);
+
+	if(!Chapters(job, error))
+	{
+		cerr << "Error! " << error << "\n";
+		return 1;
+	}
+	return 0;
+}
+
+// write one chapter*.xhtml for every title of the input, starting at the beginning chapter.
+bool Chapters(const Job& job, string& error)
+{
+	if(job.begin.empty() || job.begin.find_first_not_of("0123456789") != string::npos)
+	{
+		error = "The beginning chapter has to be a whole number.";
+		return false;
+	}
+
+	ifstream ui;
+	ui.open(job.input);
+	if(!ui.is_open())
+	{
+		error = "Cannot open " + job.input + ".";
+		return false;
+	}
+	ofstream ux;
+
+	string filename, title, folder = job.output;
+	if(!folder.empty() && folder[folder.size() - 1] != '/' && folder[folder.size() - 1] != '\\') folder += '/';
+
+	Number chapter(job.begin);
+	while(getline(ui, title))
+	{
+		filename = folder + "chapter" + chapter.ConvString() + ".xhtml";
+		ux.open(filename);
+		if(!ux.is_open())
+		{
+			error = "Cannot open " + filename + ".";
+			return false;
+		}
+
+		ux << "<?xml version=\"1.0\" encoding=\"utf-8\" standalone=\"no\"?>\n<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.1//EN\"\n  \"http://www.w3.org/TR/xhtml11/DTD/xhtml11.dtd\">\n\n<html xmlns=\"http://www.w3.org/1999/xhtml\">\n\n<head>\n  <title>chapter";
+		ux << chapter.ConvString() << "</title>\n  <link href=\"../Styles/style.css\" rel=\"stylesheet\" type=\"text/css\" />\n</head>\n\n<body>\n  <h1>";
+		ux << title << "</h1>\n\n  <p>(This article)</p>\n\n</body>\n</html>";
+
+		chapter.PlusOne();
+		ux.close();
+	}
+
+	return true;
+}
+
+// read --name value, (or --name=value), pairs.
+bool ReadArguments(const vector<string>& arguments, Job& job, string& error)
+{
+	for(size_t a=0;arguments.size()>a;a++)
+	{
+		string name = arguments[a], value;
+		size_t equal = name.find('=');
+		if(equal != string::npos)
+		{
+			value = name.substr(equal + 1);
+			name.erase(equal);
+		}
+		else if(name == "--help" || name == "-h")
+		{
+			error = "";
+			return false;
+		}
+		else if(arguments.size() > a + 1) value = arguments[++a];
+		else
+		{
+			error = name + " needs a value.";
+			return false;
+		}
+
+		if(name == "--begin") job.begin = value;
+		else if(name == "--input") job.input = value;
+		else if(name == "--output") job.output = value;
+		else if(name == "--batch") job.batch = value;
+		else if(name == "--jobs")
+		{
+			if(value.empty() || value.find_first_not_of("0123456789") != string::npos || value.size() > 4)
+			{
+				error = "--jobs needs a number of workers.";
+				return false;
+			}
+			job.jobs = stoi(value);
+		}
+		else
+		{
+			error = "Unknown option " + name + ".";
+			return false;
+		}
+	}
+
+	if(job.batch.empty() && job.begin.empty())
+	{
+		error = "--begin is needed.";
+		return false;
+	}
+	return true;
+}
+
+// write every book of the batch file, --jobs books at a time.
+int RunBatch(const Job& settings)
+{
+	ifstream manifest(settings.batch);
+	if(!manifest.is_open())
+	{
+		cerr << "Error! Cannot open " << settings.batch << ".\n";
+		return 1;
+	}
+
+	vector<Job> jobs;
+	vector<size_t> lines;
+	string line, error;
+	int failed = 0;
+	for(size_t number=1;getline(manifest, line);number++)
+	{
+		if(!line.empty() && line[line.size() - 1] == '\r') line.erase(line.size() - 1);
+
+		vector<string> arguments;
+		istringstream words(line);
+		for(string word;words >> word;) arguments.push_back(word);
+		if(arguments.empty() || arguments[0][0] == '#') continue;
+
+		Job job;
+		if(!ReadArguments(arguments, job, error) || !job.batch.empty())
+		{
+			cerr << settings.batch << ":" << number << ": Error! " << (job.batch.empty() ? error : "a batch cannot run another batch.") << "\n";
+			failed = 1;
+			continue;
+		}
+		jobs.push_back(job);
+		lines.push_back(number);
+	}
+
+	unsigned int workers = settings.jobs ? settings.jobs : thread::hardware_concurrency();
+	if(workers == 0) workers = 1;
+
+	atomic<size_t> next(0);
+	atomic<int> result(failed);
+	vector<thread> running;
+	for(unsigned int a=0;workers>a;a++)
+	{
+		running.push_back(thread([&]()
+		{
+			for(size_t b=next++;jobs.size()>b;b=next++)
+			{
+				string reason;
+				if(!Chapters(jobs[b], reason))
+				{
+					string message = settings.batch + ":" + to_string(lines[b]) + ": Error! " + reason + "\n";
+					cerr << message;
+					result = 1;
+				}
+			}
+		}));
+	}
+	for(unsigned int a=0;workers>a;a++) running[a].join();
+	return result;
 }
 
-Number::Number(char *init)
+Number::Number(const string& init)
 {
-	this->number = new char[200];
 	this->number = init;
 }
 
 void Number::PlusOne(void)
 {
-	int length;
-	for(length=0;;length++) if(this->number[length] == '\0') break;
-	length--;
+	int length = static_cast<int>(this->number.size()) - 1;
 	
 	if('9' > this->number[length] && this->number[length] >= '0')
 	{
@@ -84,15 +259,14 @@ void Number::PlusOne(void)
 		}
 		else
 		{
-			this->number[0] = '1';
-			length++;
-			for(none=1;length>=none;none++) this->number[none] = '0';
+			// all nines, (999 -> 1000), the number gets one more digit.
+			for(none=0;length>=none;none++) this->number[none] = '0';
+			this->number.insert(0, 1, '1');
 		}
 	}
 }
 
 string Number::ConvString(void)
 {
-	string brige(this->number);
-	return brige;
+	return this->number;
 }
\ No newline at end of file
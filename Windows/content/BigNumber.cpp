@@ -34,13 +34,106 @@
 #include <limits>
 #include <cstring> // strcmp
 #include <algorithm> // reverse
+#include <cmath>     // log, log10, sqrt
+#include <mutex>     // lock for the constants
+#include <atomic>    // latest value of the constants
+#include <memory>    // unique_ptr
+#include <new>       // placement new for the arena blocks
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h> // SSE2 and AVX2, chosen when we run
+#endif
+
+// we can read 8 numbers in a 64 bit number, (the first number in the lowest byte).
+#if defined(_WIN32) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define BIGNUMBER_LITTLE_ENDIAN 1
+#else
+#define BIGNUMBER_LITTLE_ENDIAN 0
+#endif
 
 namespace MyOddWeb
 {
+    // the powers of the base that fit in a limb, 10^0 to 10^9
+    static const unsigned int _limb_powers[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
     //  set the constants to zero for now.
     BigNumber BigNumber::_e = 0;
     BigNumber BigNumber::_pi = 0;
 
+    /**
+     * A constant we calculate to a given precision and share between threads.
+     * Readers only load the latest value, only a thread that needs a more precise value takes the lock.
+     * The values are never deleted as another thread might still be reading them,
+     * but as each is at least twice as precise as the previous one, they are never much more than the latest one.
+     */
+    struct BigNumberConstant
+    {
+        struct Value
+        {
+            BigNumber number;
+            size_t precision;
+        };
+        std::atomic<const Value*> latest;
+        std::mutex lock;
+        std::vector<std::unique_ptr<const Value>> values;
+    };
+
+    // the most precise e, pi and 2*pi we calculated.
+    // @see e( size_t ), pi( size_t ) and _NormalizeAngle( ... )
+    static BigNumberConstant _e_constant;
+    static BigNumberConstant _pi_constant;
+    static BigNumberConstant _two_pi_constant;
+
+    // the arena in use on this thread, if any.
+    static thread_local BigNumber::Arena* _current_arena = NULL;
+
+    /**
+     * While it exists the limbs on this thread are allocated from the heap, not from the arena in use, if any.
+     * The constants are kept forever, they would keep the blocks of the arena they were allocated from.
+     */
+    struct BigNumberNoArena
+    {
+        BigNumberNoArena() : arena(_current_arena) { _current_arena = NULL; }
+        ~BigNumberNoArena() { _current_arena = arena; }
+        BigNumber::Arena* arena;
+    };
+
+    /**
+     * Get a constant with at least 'precision' decimals, calculate it if we do not have it yet.
+     * We calculate it to 128 decimals, or twice that, or twice that ...
+     * so asking for a few more decimals each time does not mean calculating it again every time.
+     * @param BigNumberConstant& constant the constant we want.
+     * @param size_t precision the number of decimals we want.
+     * @param BigNumber(*calculate)(size_t) the function that calculates it to a given precision.
+     * @return const BigNumber& the constant, with at least 'precision' decimals.
+     */
+    static const BigNumber& _GetConstant(BigNumberConstant& constant, size_t precision, BigNumber(*calculate)(size_t))
+    {
+        // most of the time we have it already.
+        const BigNumberConstant::Value* value = constant.latest.load(std::memory_order_acquire);
+        if (value != NULL && value->precision >= precision)
+        {
+            return value->number;
+        }
+
+        // only one thread at a time can calculate it,
+        // another thread might have done it while we were waiting.
+        std::lock_guard<std::mutex> lock(constant.lock);
+        value = constant.latest.load(std::memory_order_relaxed);
+        if (value == NULL || value->precision < precision)
+        {
+            BigNumberNoArena noArena;
+            size_t level = 128;
+            while (level < precision)
+            {
+                level *= 2;
+            }
+            constant.values.push_back(std::unique_ptr<const BigNumberConstant::Value>(new BigNumberConstant::Value{ calculate(level), level }));
+            value = constant.values.back().get();
+            constant.latest.store(value, std::memory_order_release);
+        }
+        return value->number;
+    }
+
     // zero.
     const BigNumber BigNumber::_number_zero = 0;
 
@@ -53,7 +146,7 @@ namespace MyOddWeb
     BigNumber::BigNumber()
     {
         Default();
-        _numbers.push_back(0); // positive zero.
+        _zero = true; // positive zero.
     }
 
     BigNumber::BigNumber(const char* source)
@@ -97,7 +190,7 @@ namespace MyOddWeb
         _decimals = decimals;
 
         // just copy the number
-        _numbers = numbers;
+        BigNumber::_NumbersToLimbs(numbers, _limbs);
 
         // clean up if need be.
         PerformPostOperations(decimals);
@@ -109,6 +202,12 @@ namespace MyOddWeb
         *this = source;
     }
 
+    BigNumber::BigNumber(BigNumber&& source)
+    {
+        Default();
+        *this = std::move(source);
+    }
+
     /**
      * set the default values.
      */
@@ -118,15 +217,28 @@ namespace MyOddWeb
         _neg = false;
         _nan = false;
         _decimals = 0;
-        _numbers.clear();
+        _limbs.clear();
     }
 
     BigNumber& BigNumber::operator=(const BigNumber& rhs)
     {
         if (this != &rhs)
         {
-            _numbers.clear();
-            _numbers = rhs._numbers;
+            _limbs = rhs._limbs;
+            _neg = rhs.IsNeg();
+            _nan = rhs.IsNan();
+            _zero = rhs.IsZero();
+            _decimals = rhs._decimals;
+        }
+        return *this;
+    }
+
+    BigNumber& BigNumber::operator=(BigNumber&& rhs)
+    {
+        if (this != &rhs)
+        {
+            // take the limbs rather than copying them.
+            _limbs = std::move(rhs._limbs);
             _neg = rhs.IsNeg();
             _nan = rhs.IsNan();
             _zero = rhs.IsZero();
@@ -139,6 +251,289 @@ namespace MyOddWeb
     {
     }
 
+    /**
+     * A block of memory in an arena, the limbs follow the block itself.
+     * Each limbs allocated from it holds a reference, and so does the arena until it moves on to the next block.
+     */
+    class BigNumber::ArenaBlock
+    {
+    public:
+        static ArenaBlock* Create(size_t size, ArenaBlock* next)
+        {
+            void* memory = ::operator new(sizeof(ArenaBlock) + size * sizeof(unsigned int));
+            return new (memory) ArenaBlock(size, next);
+        }
+
+        unsigned int* Allocate(size_t count)
+        {
+            unsigned int* limbs = reinterpret_cast<unsigned int*>(this + 1) + _used;
+            _used += count;
+            _references.fetch_add(1, std::memory_order_relaxed);
+            return limbs;
+        }
+
+        size_t Available() const
+        {
+            return _size - _used;
+        }
+
+        size_t Size() const
+        {
+            return _size;
+        }
+
+        // only the arena holds it, all the limbs allocated from it have been freed.
+        // no other thread can take a reference, so it is safe to allocate from the start again.
+        bool Unused() const
+        {
+            return _references.load(std::memory_order_acquire) == 1;
+        }
+
+        void Rewind()
+        {
+            _used = 0;
+        }
+
+        // the next block of the arena, only the thread of the arena uses it.
+        ArenaBlock* _next;
+
+        void Release()
+        {
+            // the limbs could be freed from another thread.
+            if (_references.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            {
+                this->~ArenaBlock();
+                ::operator delete(this);
+            }
+        }
+
+    private:
+        ArenaBlock(size_t size, ArenaBlock* next) : _next(next), _references(1), _used(0), _size(size) {}
+
+        std::atomic<size_t> _references;
+        size_t _used;
+        size_t _size;
+    };
+
+    BigNumber::Arena::Arena(size_t limbs) : _previous(_current_arena), _block(NULL), _limbs(limbs)
+    {
+        _current_arena = this;
+    }
+
+    BigNumber::Arena::~Arena()
+    {
+        Reset();
+        _current_arena = _previous;
+    }
+
+    /**
+     * Let go of all the blocks, the next limbs will be allocated from a new one.
+     * Each block is freed as soon as the limbs in it are freed, (now if they already are).
+     */
+    void BigNumber::Arena::Reset()
+    {
+        while (_block != NULL)
+        {
+            ArenaBlock* next = _block->_next;
+            _block->Release();
+            _block = next;
+        }
+    }
+
+    /**
+     * Allocate limbs from the current block, or from a new block if it is full.
+     * @param size_t count the number of limbs we want.
+     * @param ArenaBlock*& block the block the limbs were allocated from.
+     * @return unsigned int* the limbs.
+     */
+    unsigned int* BigNumber::Arena::_allocate(size_t count, ArenaBlock*& block)
+    {
+        if (_block == NULL || _block->Available() < count)
+        {
+            _block = _NextBlock(count);
+        }
+        block = _block;
+        return _block->Allocate(count);
+    }
+
+    /**
+     * Get a block we can allocate 'count' limbs from and put it at the front of the arena,
+     * reuse one of ours if all the limbs in it have been freed, or create a new one.
+     * @param size_t count the number of limbs we want.
+     * @return ArenaBlock* the block, with no limbs allocated.
+     */
+    BigNumber::ArenaBlock* BigNumber::Arena::_NextBlock(size_t count)
+    {
+        for (ArenaBlock** link = &_block; *link != NULL; link = &(*link)->_next)
+        {
+            ArenaBlock* block = *link;
+            if (block->Size() >= count && block->Unused())
+            {
+                *link = block->_next;
+                block->_next = _block;
+                block->Rewind();
+                return block;
+            }
+        }
+        return ArenaBlock::Create(count > _limbs ? count : _limbs, _block);
+    }
+
+    void BigNumber::LIMBS::_free()
+    {
+        if (_block != NULL)
+        {
+            _block->Release();
+            _block = NULL;
+        }
+        else if (_memory() != _inline)
+        {
+            delete[] _memory();
+        }
+    }
+
+    BigNumber::LIMBS& BigNumber::LIMBS::operator=(const LIMBS& rhs)
+    {
+        if (this != &rhs)
+        {
+            clear();
+            reserve(rhs._size);
+            std::memcpy(_data, rhs._data, rhs._size * sizeof(unsigned int));
+            _size = rhs._size;
+        }
+        return *this;
+    }
+
+    BigNumber::LIMBS& BigNumber::LIMBS::operator=(LIMBS&& rhs)
+    {
+        if (this == &rhs)
+        {
+            return *this;
+        }
+
+        // if the limbs are inline there is nothing to take, so we copy them
+        // that way we also keep our own memory, if we have any.
+        if (rhs._memory() == rhs._inline)
+        {
+            return *this = rhs;
+        }
+
+        // otherwise we take the memory and leave rhs empty.
+        _free();
+        _data = rhs._data;
+        _size = rhs._size;
+        _capacity = rhs._capacity;
+        _head = rhs._head;
+        _block = rhs._block;
+        rhs._data = rhs._inline;
+        rhs._size = 0;
+        rhs._capacity = BIGNUMBER_INLINE_LIMBS;
+        rhs._head = 0;
+        rhs._block = NULL;
+        return *this;
+    }
+
+    /**
+     * Make sure that we can hold at least 'capacity' limbs
+     * Once we are past the inline limbs, we double the size so we do not allocate all the time.
+     * @param size_t capacity the number of limbs we want to be able to hold.
+     */
+    void BigNumber::LIMBS::reserve(size_t capacity)
+    {
+        if (capacity <= _capacity)
+        {
+            return;
+        }
+
+        // if we have enough free space in front, we move the limbs back there.
+        if (capacity <= _capacity + _head)
+        {
+            std::memmove(_memory(), _data, _size * sizeof(unsigned int));
+            _data -= _head;
+            _capacity += _head;
+            _head = 0;
+            return;
+        }
+
+        const size_t total = _capacity + _head;
+        if (capacity < total * 2)
+        {
+            capacity = total * 2;
+        }
+
+        // from the arena of this thread, if there is one.
+        ArenaBlock* block = NULL;
+        unsigned int* data = (_current_arena != NULL) ? _current_arena->_allocate(capacity, block) : new unsigned int[capacity];
+        std::memcpy(data, _data, _size * sizeof(unsigned int));
+        _free();
+        _block = block;
+        _data = data;
+        _capacity = capacity;
+        _head = 0;
+    }
+
+    void BigNumber::LIMBS::resize(size_t size, unsigned int value)
+    {
+        reserve(size);
+        for (size_t i = _size; i < size; ++i)
+        {
+            _data[i] = value;
+        }
+        _size = size;
+    }
+
+    void BigNumber::LIMBS::assign(size_t size, unsigned int value)
+    {
+        _size = 0;
+        resize(size, value);
+    }
+
+    BigNumber::LIMBS::iterator BigNumber::LIMBS::insert(iterator position, size_t count, unsigned int value)
+    {
+        // if we are adding limbs in front and we have the space for it
+        // then we just need to move the start of our limbs.
+        if (position == _data && count <= _head)
+        {
+            _data -= count;
+            _head -= count;
+            _capacity += count;
+            _size += count;
+            for (size_t i = 0; i < count; ++i)
+            {
+                _data[i] = value;
+            }
+            return _data;
+        }
+
+        // the position might move if we have to allocate more memory.
+        const size_t index = position - _data;
+        reserve(_size + count);
+        std::memmove(_data + index + count, _data + index, (_size - index) * sizeof(unsigned int));
+        for (size_t i = 0; i < count; ++i)
+        {
+            _data[index + i] = value;
+        }
+        _size += count;
+        return _data + index;
+    }
+
+    BigNumber::LIMBS::iterator BigNumber::LIMBS::erase(iterator first, iterator last)
+    {
+        // removing limbs from the front does not need to move the others
+        // we keep the space in front in case we need it later.
+        if (first == _data)
+        {
+            const size_t count = last - first;
+            _data += count;
+            _head += count;
+            _capacity -= count;
+            _size -= count;
+            return _data;
+        }
+        std::memmove(first, last, (end() - last) * sizeof(unsigned int));
+        _size -= (last - first);
+        return first;
+    }
+
     /**
      * return if the number is an integer or not.
      * @see https://en.wikipedia.org/wiki/Integer
@@ -202,14 +597,13 @@ namespace MyOddWeb
         // positive
         _neg = (source < 0);
 
-        // make it positive.
-        long long c = abs(source);
+        // make it positive, (in unsigned so the smallest long long does not overflow).
+        unsigned long long c = _neg ? 0ULL - (unsigned long long)source : (unsigned long long)source;
         while (c > 0)
         {
-            unsigned char s = c % BIGNUMBER_BASE;
-            _numbers.push_back(s);
+            _limbs.push_back((unsigned int)(c % BIGNUMBER_LIMB_BASE));
 
-            c = static_cast<long long>(c / BIGNUMBER_BASE);
+            c = c / BIGNUMBER_LIMB_BASE;
         }
 
         // clean it all up
@@ -248,10 +642,37 @@ namespace MyOddWeb
         // where the decimal point is.
         int decimalPoint = -1;
 
+        // the numbers as we read them, the biggest number first, (as characters).
+        // small numbers, (nearly all of them), do not need to allocate.
+        const size_t length = strlen(source);
+        char buffer[64];
+        std::unique_ptr<char[]> allocated;
+        char* numbers = buffer;
+        if (length + 1 > sizeof(buffer))
+        {
+            allocated.reset(new char[length + 1]);
+            numbers = allocated.get();
+        }
+        size_t count = 0;
+
         // walk the number.
         const char* c = source;
-        while (*c)
+        const char* end = source + length;
+        while (c < end)
         {
+            // copy the runs of numbers in one go.
+            const size_t run = BigNumber::_DigitsRun(c, end - c);
+            if (run > 0)
+            {
+                std::memcpy(numbers + count, c, run);
+                count += run;
+                c += run;
+
+                // either way, signs are no longer allowed.
+                allowSign = false;
+                continue;
+            }
+
             if (true == allowSign)
             {
                 if (*c == '-')
@@ -281,29 +702,26 @@ namespace MyOddWeb
             // decimal
             if (decimalPoint == -1 && *c == '.')
             {
-                decimalPoint = (int)_numbers.size();
+                decimalPoint = (int)count;
                 if (decimalPoint == 0)
                 {
                     //  make sure it is '0.xyz' rather than '.xyz'
-                    _numbers.push_back(0);
+                    numbers[count++] = '0';
                     ++decimalPoint;
                 }
                 c++;
                 continue;
             }
 
-            if (*c < '0' || *c > '9')
-            {
-                throw std::runtime_error("The given value is not a number.");
-            }
-            _numbers.insert(_numbers.begin(), *c++ - '0');
-
-            // either way, signs are no longer allowed.
-            allowSign = false;
+            // it is not a number, (or we would have copied it).
+            throw std::runtime_error("The given value is not a number.");
         }
 
         // get the number of decimals.
-        _decimals = (decimalPoint == -1) ? 0 : _numbers.size() - (size_t)decimalPoint;
+        _decimals = (decimalPoint == -1) ? 0 : count - (size_t)decimalPoint;
+
+        // pack the numbers in limbs.
+        BigNumber::_DigitsToLimbs(numbers, count, _limbs);
 
         // clean it all up.
         PerformPostOperations(_decimals);
@@ -333,8 +751,8 @@ namespace MyOddWeb
         }
         else
         {
-            _numbers.erase(_numbers.begin() + _decimals, _numbers.end());
-            _numbers.push_back(0);
+            // only keep the decimals.
+            BigNumber::_ModuloLimbsByBase(_limbs, _decimals);
         }
 
         // truncate and return, the sign is kept.
@@ -371,7 +789,7 @@ namespace MyOddWeb
         if (_decimals > precision)
         {
             size_t end = _decimals - precision;
-            _numbers.erase(_numbers.begin(), _numbers.begin() + end);
+            BigNumber::_DevideLimbsByBase(_limbs, end);
             _decimals -= end;
         }
 
@@ -392,6 +810,12 @@ namespace MyOddWeb
             return *this;
         }
 
+        // if we do not have more decimals than the precision, there is nothing to round.
+        if (_decimals <= precision)
+        {
+            return PerformPostOperations(precision);
+        }
+
         if (IsNeg())
         {
             _neg = false;
@@ -480,71 +904,28 @@ namespace MyOddWeb
         // assume that we are not zero
         _zero = false;
 
-        while (_decimals > 0)
+        // remove the 'leading' zeros, remember that the limbs are in reverse.
+        while (!_limbs.empty() && _limbs.back() == 0)
         {
-            //  get the decimal number
-            NUMBERS::const_iterator it = _numbers.begin();
-            if (it == _numbers.end())
-            {
-                // we have no more numbers
-                // we have reached the end.
-                // there can be no decimals.
-                _decimals = 0;
-                break;
-            }
-
-            if (*it != 0)
-            {
-                //  we are done.
-                break;
-            }
-
-            // remove that number
-            _numbers.erase(it);
-
-            // move back one decimal.
-            --_decimals;
-        }
-
-        // remember that the numbers are in reverse
-        for (;;)
-        {
-            // get the last number
-            NUMBERS::const_reverse_iterator it = _numbers.rbegin();
-
-            // do we have a number?
-            if (it == _numbers.rend())
-            {
-                break;
-            }
-
-            if (*it != 0)
-            {
-                //  we are done.
-                break;
-            }
-
-            // remove that 'leading' zero.
-            _numbers.erase(std::next(it).base());
+            _limbs.pop_back();
         }
 
         //  are we zero?
-        size_t l = _numbers.size();
-        if (l == 0)
+        if (_limbs.empty())
         {
             //  this is empty, so the number _must_ be zero
             _neg = false;
             _zero = true;
             _decimals = 0;
-            _numbers.push_back(0);
-            ++l;
+            return *this;
         }
 
-        while (l < _decimals + 1)
+        // remove the decimal zeros we do not need, 1.200 = 1.2
+        size_t zeros = BigNumber::_TrailingZeros(_limbs, _decimals);
+        if (zeros > 0)
         {
-            //  this is empty, so the number _must_ be zero
-            _numbers.push_back(0);
-            ++l;
+            BigNumber::_DevideLimbsByBase(_limbs, zeros);
+            _decimals -= zeros;
         }
 
         //  return this number.
@@ -583,55 +964,60 @@ namespace MyOddWeb
             return lhs;
         }
 
-        // the decimal place.
-        size_t decimals = 0;
-
-        // the result
-        NUMBERS c;
-
         // remove unneeded decimal places.
         BigNumber tlhs = BigNumber(lhs).Round(BIGNUMBER_PRECISION_PADDED(precision));
         BigNumber trhs = BigNumber(rhs).Round(BIGNUMBER_PRECISION_PADDED(precision));
 
-        // the number we are working with.
-        BigNumber number(tlhs);
-        number._neg = false;
-
-        // quotien/remainder we will use.
-        BigNumber quotient;
-        BigNumber remainder;
+        // the denominator is too small for the precision we want, we have nothing to divide by.
+        if (trhs.IsZero())
+        {
+            return _number_zero;
+        }
 
-        // divide until we are done ... or we reached the presision limit.
-        for (;;)
+        // if both numbers fit in 64 bits, (once they have the same decimals), we can use them as they are
+        // for as long as the result itself also fits in 64 bits.
+        const size_t maxDecimals = (tlhs._decimals >= trhs._decimals ? tlhs._decimals : trhs._decimals);
+        LIMBS lhsBuffer, rhsBuffer;
+        const LIMBS& lhsLimbs = tlhs._AlignedLimbs(maxDecimals, lhsBuffer);
+        const LIMBS& rhsLimbs = trhs._AlignedLimbs(maxDecimals, rhsBuffer);
+        unsigned long long n, d;
+        if (BigNumber::_LimbsToULongLong(lhsLimbs, n) && BigNumber::_LimbsToULongLong(rhsLimbs, d) && d != 0)
         {
-            // get the quotient and remainder.
-            BigNumber::QuotientAndRemainder(number, trhs, quotient, remainder);
+            unsigned long long q = n / d;
+            unsigned long long r = n % d;
 
-            // add the quotien to the current number.
-            c.insert(c.begin(), quotient._numbers.begin(), quotient._numbers.end());
+            // the decimal place.
+            size_t decimals = 0;
 
-            //  are we done?
-            if (remainder.IsZero())
+            // r < d so r * 10 cannot overflow, but q might.
+            while (r != 0 && decimals < precision && q <= (std::numeric_limits<unsigned long long>::max() - 9) / BIGNUMBER_BASE)
             {
-                break;
+                r *= BIGNUMBER_BASE;
+                q = q * BIGNUMBER_BASE + r / d;
+                r %= d;
+                ++decimals;
             }
 
-            // 
-            number = remainder;
-            number.MultiplyByBase(1);
-
-            // have we reached our limit?
-            if (decimals >= precision)
+            // if we are done, then this is our number
+            // otherwise we have to do it the long way.
+            if (r == 0 || decimals >= precision)
             {
-                break;
+                BigNumber result;
+                BigNumber::_ULongLongToLimbs(q, result._limbs);
+                result._decimals = decimals;
+                return result.PerformPostOperations(decimals);
             }
-
-            //  the number of decimal
-            ++decimals;
         }
 
-        // then create the result with the known number of decimals.
-        return BigNumber(c, decimals, false);
+        // lhs / rhs = (lhs * BIGNUMBER_BASE^precision / rhs) / BIGNUMBER_BASE^precision
+        // both numbers have the same number of decimals, so we can divide the limbs as they are.
+        LIMBS numerator(lhsLimbs);
+        BigNumber::_MultiplyLimbsByBase(numerator, precision);
+
+        BigNumber result;
+        BigNumber::_DivModLimbs(numerator, rhsLimbs, result._limbs, NULL);
+        result._decimals = precision;
+        return result.PerformPostOperations(precision);
     }
 
     /**
@@ -664,8 +1050,13 @@ namespace MyOddWeb
         // if we have decimals, we need to do it the hard/long way...
         if (copyExp._decimals > 0)
         {
-            copyBase.Ln(BIGNUMBER_PRECISION_PADDED(precision)); //  we need the correction, do we don't loose it too quick.
-            copyBase.Mul(copyExp, BIGNUMBER_PRECISION_PADDED(precision));
+            // the result has about exp * log10(base) whole numbers, so the logarithm
+            // needs that many more decimals for the result to be correct to the precision.
+            const long long whole = (long long)(copyBase._limbs.size() * BIGNUMBER_LIMB_DIGITS) - (long long)copyBase._decimals;
+            const size_t decimals = BIGNUMBER_PRECISION_PADDED(precision) + (whole > 0 ? (size_t)(whole * copyExp.ToDouble()) + 1 : 0);
+
+            copyBase.Ln(decimals); //  we need the correction, do we don't loose it too quick.
+            copyBase.Mul(copyExp, decimals);
             result = copyBase.Exp(BIGNUMBER_PRECISION_PADDED(precision));
         }
         else
@@ -703,62 +1094,769 @@ namespace MyOddWeb
      * @return BigNumber the product of the two numbers.
      */
     BigNumber BigNumber::AbsMul(const BigNumber& lhs, const BigNumber& rhs, size_t precision)
+    {
+        BigNumber c(lhs);
+        c.AbsMulAssign(rhs, precision);
+        return c;
+    }
+
+    /**
+     * Multiply this number by another, ignoring the signs.
+     * The product is positive, unless one of the number is one, (then we are set to the other number).
+     * @see AbsMul( ... )
+     * @param const BigNumber& rhs the number multipling
+     * @param size_t precision the max precision we want to use.
+     */
+    void BigNumber::AbsMulAssign(const BigNumber& rhs, size_t precision)
     {
         // if either number is zero, then the total is zero
         // that's the rule.
-        if (lhs.IsZero() || rhs.IsZero())
+        if (IsZero() || rhs.IsZero())
         {
             //  zero * anything = zero.
-            return _number_zero;
+            *this = _number_zero;
+            return;
         }
 
         // anything multiplied by one == anything
-        if (BigNumber::AbsCompare(lhs, _number_one) == 0) // 1 x rhs = rhs
+        if (BigNumber::AbsCompare(*this, _number_one) == 0) // 1 x rhs = rhs
         {
-            return rhs;
+            *this = rhs;
+            return;
         }
         if (BigNumber::AbsCompare(rhs, _number_one) == 0) // lhs x 1 = lhs
         {
-            return lhs;
+            return;
         }
 
-        int maxDecimals = (int)(lhs._decimals >= rhs._decimals ? lhs._decimals : rhs._decimals);
+        size_t maxDecimals = (_decimals >= rhs._decimals ? _decimals : rhs._decimals);
 
-        // if we have more than one decimals then we have to shift everything
-        // by maxDecimals * BIGNUMBER_BASE
-        // this will allow us to do the multiplication. 
+        // if we have decimals then we do not need more of them than the precision
+        // the limbs themselves never have decimals, so they can be multiplied as they are.
+        BigNumber trhs;
         if (maxDecimals > 0)
         {
             // remove unneeded decimal places.
-            BigNumber tlhs = BigNumber(lhs).Round(BIGNUMBER_PRECISION_PADDED(precision));
-            BigNumber trhs = BigNumber(rhs).Round(BIGNUMBER_PRECISION_PADDED(precision));
-
-            // the final number of decimals is the total number of decimals we used.
-            // 10.12 * 10.12345=102.4493140
-            // 1012 * 1012345 = 1024493140
-            // decimals = 2 + 5 = 102.4493140
-            size_t decimals = tlhs._decimals + trhs._decimals;
+            trhs = BigNumber(rhs).Round(BIGNUMBER_PRECISION_PADDED(precision));
+            Round(BIGNUMBER_PRECISION_PADDED(precision));
+        }
+        const BigNumber& r = (maxDecimals > 0) ? trhs : rhs;
+
+        // the final number of decimals is the total number of decimals we used.
+        // 10.12 * 10.12345=102.4493140
+        // 1012 * 1012345 = 1024493140
+        // decimals = 2 + 5 = 102.4493140
+        // we need somewhere to put the product, so we move our limbs out of the way,
+        // (if we are multiplying by ourselves, then both numbers are the limbs we moved).
+        const bool same = (&r == this);
+        LIMBS lhs(std::move(_limbs));
+        _limbs.clear();
+        BigNumber::_MulLimbs(lhs, same ? lhs : r._limbs, _limbs);
+
+        //  set the current number of decimals.
+        _decimals += r._decimals;
+        _neg = false;
 
-            // copy the lhs with no decimals
-            tlhs.MultiplyByBase(tlhs._decimals);
+        // clean up
+        PerformPostOperations(precision);
+    }
 
-            // copy the rhs with no decimals
-            trhs.MultiplyByBase(trhs._decimals);
+    /**
+     * Subtract 2 absolute numbers together.
+     * @param const BigNumber& lhs the number been subtracted from
+     * @param const BigNumber& rhs the number been subtracted with.
+     * @return BigNumber the diff of the two numbers.
+     */
+    BigNumber BigNumber::AbsSub(const BigNumber& lhs, const BigNumber& rhs)
+    {
+        // compare the 2 numbers
+        if (BigNumber::AbsCompare(lhs, rhs) < 0)
+        {
+            // swap the two values to get a positive result.
+            BigNumber c = BigNumber::AbsSub(rhs, lhs);
 
-            // do the multiplication without any decimals.
-            BigNumber c = BigNumber::AbsMul(tlhs, trhs, 0);
+            // but we know it is negative
+            c._neg = true;
 
-            //  set the current number of decimals.
-            c.DevideByBase(decimals);
+            // return the number
+            return c.PerformPostOperations(c._decimals);
+        }
 
-            // return the value.
-            return c.PerformPostOperations(precision);
+        // if we want to subtract zero from the lhs, then the result is rhs
+        if (rhs.IsZero())
+        {
+            return lhs;
         }
 
-        //  15 * 5  = 5*5 = 25 = push(5) carry_over = 2
-        //          = 5*1+ccarry_over) = 7 push(7)
-        //          = 75
+        // we know that lhs is greater than rhs.
+        BigNumber c(lhs);
+        c._neg = false;
+        c.AbsSubAssign(rhs);
 
+        // this is the new numbers
+        return c;
+    }
+
+    /**
+     * Subtract a number from this number, ignoring both signs, |this| = | |this| - |rhs| |
+     * The sign of this number is not changed and we reuse our own limbs.
+     * @param const BigNumber& rhs the number been subtracted.
+     */
+    void BigNumber::AbsSubAssign(const BigNumber& rhs)
+    {
+        // get the maximum number of decimals.
+        const size_t maxDecimals = (_decimals >= rhs._decimals ? _decimals : rhs._decimals);
+
+        // line up both numbers so they have the same number of decimals.
+        // (rhs first in case rhs is this number).
+        LIMBS rhsBuffer;
+        const LIMBS& r = rhs._AlignedLimbs(maxDecimals, rhsBuffer);
+        BigNumber::_MultiplyLimbsByBase(_limbs, maxDecimals - _decimals);
+        _decimals = maxDecimals;
+
+        BigNumber::_SubLimbsAssign(_limbs, r);
+
+        // clean up.
+        PerformPostOperations(maxDecimals);
+    }
+
+    /**
+     * Get a number at a certain position, (from the last digit)
+     * In a number 1234.456 position #0 = 6 and #3=4
+     * @param size_t position the number we want.
+     * @return unsigned char the number or 0 if we do not have that many numbers.
+     */
+    unsigned char BigNumber::_At(size_t position) const
+    {
+        // the limbs are saved in reverse, 9 numbers per limb.
+        //    #1234567890.12 = [456789012][123]
+        const size_t limb = position / BIGNUMBER_LIMB_DIGITS;
+        if (limb >= _limbs.size())
+        {
+            return 0;
+        }
+        return (unsigned char)((_limbs[limb] / _limb_powers[position % BIGNUMBER_LIMB_DIGITS]) % BIGNUMBER_BASE);
+    }
+
+    /**
+     * Get the limbs of this number as if it had the given number of decimals.
+     * 'decimals' must be greater or equal to our own number of decimals.
+     * so the number 123.45 with 4 decimals becomes 1234500
+     * @param size_t decimals the number of decimals we want.
+     * @param LIMBS& buffer where we will build the number if we need to.
+     * @return const LIMBS& either our own limbs or the buffer.
+     */
+    const BigNumber::LIMBS& BigNumber::_AlignedLimbs(size_t decimals, LIMBS& buffer) const
+    {
+        if (decimals == _decimals)
+        {
+            // nothing to do, we can use our own numbers.
+            return _limbs;
+        }
+        buffer = _limbs;
+        BigNumber::_MultiplyLimbsByBase(buffer, decimals - _decimals);
+        return buffer;
+    }
+
+    /**
+     * Add 2 absolute numbers together.
+     * @param const BigNumber& lhs the number been Added from
+     * @param const BigNumber& rhs the number been Added with.
+     * @return BigNumber the sum of the two numbers.
+     */
+    BigNumber BigNumber::AbsAdd(const BigNumber& lhs, const BigNumber& rhs)
+    {
+        BigNumber c(lhs);
+        c._neg = false;
+        c.AbsAddAssign(rhs);
+
+        // this is the new numbers
+        return c;
+    }
+
+    /**
+     * Add a number to this number, ignoring both signs, |this| = |this| + |rhs|
+     * The sign of this number is not changed and we reuse our own limbs.
+     * @param const BigNumber& rhs the number been added.
+     */
+    void BigNumber::AbsAddAssign(const BigNumber& rhs)
+    {
+        // get the maximum number of decimals.
+        const size_t maxDecimals = (_decimals >= rhs._decimals ? _decimals : rhs._decimals);
+
+        // line up both numbers so they have the same number of decimals.
+        // (rhs first in case rhs is this number).
+        LIMBS rhsBuffer;
+        const LIMBS& r = rhs._AlignedLimbs(maxDecimals, rhsBuffer);
+        BigNumber::_MultiplyLimbsByBase(_limbs, maxDecimals - _decimals);
+        _decimals = maxDecimals;
+
+        BigNumber::_AddLimbsAssign(_limbs, r);
+
+        // clean up.
+        PerformPostOperations(maxDecimals);
+    }
+
+    /**
+     * Compare two number ignoring the sign.
+     * @param const BigNumber& lhs the left hand side number
+     * @param const BigNumber& rhs the right hand size number
+     * @return int -ve rhs is greater, +ve lhs is greater and 0 = they are equal.
+     */
+    int BigNumber::AbsCompare(const BigNumber& lhs, const BigNumber& rhs)
+    {
+        // get the maximum number of decimals.
+        size_t maxDecimals = (lhs._decimals >= rhs._decimals ? lhs._decimals : rhs._decimals);
+
+        // once both numbers have the same decimals, we can compare the limbs.
+        // something like 20.123 and 20.12 becomes 20123 and 20120
+        LIMBS lhsBuffer, rhsBuffer;
+        const LIMBS& l = lhs._AlignedLimbs(maxDecimals, lhsBuffer);
+        const LIMBS& r = rhs._AlignedLimbs(maxDecimals, rhsBuffer);
+        return BigNumber::_CompareLimbs(l, r);
+    }
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    /**
+     * The vector versions of the add, subtract and compare kernels, (8 limbs with AVX2, 4 with SSE2).
+     * A limb carries out if the sum is BIGNUMBER_LIMB_BASE or more, (generate),
+     * and passes a carry on if it is exactly BIGNUMBER_LIMB_BASE-1, (propagate), so with one bit per limb
+     * the limbs that get a carry in are ((generate << 1 | carry) + propagate) ^ propagate
+     * and the bit after the last limb is the carry out of the block.
+     * The limbs are less than 2^31, so the signed compares are fine.
+     * @see https://en.wikipedia.org/wiki/Carry-lookahead_adder
+     */
+    __attribute__((target("avx2")))
+    static unsigned int _AddLimbsAvx2(unsigned int* result, const unsigned int* lhs, const unsigned int* rhs, size_t count, unsigned int carry)
+    {
+        const __m256i max = _mm256_set1_epi32(BIGNUMBER_LIMB_BASE - 1);
+        const __m256i base = _mm256_set1_epi32(BIGNUMBER_LIMB_BASE);
+        const __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        for (size_t i = 0; i + 8 <= count; i += 8)
+        {
+            __m256i sum = _mm256_add_epi32(_mm256_loadu_si256((const __m256i*)(lhs + i)), _mm256_loadu_si256((const __m256i*)(rhs + i)));
+            const unsigned int generate = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(sum, max)));
+            const unsigned int propagate = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(sum, max)));
+            const unsigned int carries = (((generate << 1) | carry) + propagate) ^ propagate;
+            carry = carries >> 8;
+
+            // add the carries, (-1 in the limbs that get one), then take the base away where we went over.
+            const __m256i in = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32((int)carries), bits), bits);
+            sum = _mm256_sub_epi32(sum, in);
+            sum = _mm256_sub_epi32(sum, _mm256_and_si256(_mm256_cmpgt_epi32(sum, max), base));
+            _mm256_storeu_si256((__m256i*)(result + i), sum);
+        }
+        return carry;
+    }
+
+    __attribute__((target("avx2")))
+    static unsigned int _SubLimbsAvx2(unsigned int* result, const unsigned int* lhs, const unsigned int* rhs, size_t count, unsigned int borrow)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i base = _mm256_set1_epi32(BIGNUMBER_LIMB_BASE);
+        const __m256i bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+        for (size_t i = 0; i + 8 <= count; i += 8)
+        {
+            __m256i diff = _mm256_sub_epi32(_mm256_loadu_si256((const __m256i*)(lhs + i)), _mm256_loadu_si256((const __m256i*)(rhs + i)));
+            const unsigned int generate = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(zero, diff)));
+            const unsigned int propagate = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(diff, zero)));
+            const unsigned int borrows = (((generate << 1) | borrow) + propagate) ^ propagate;
+            borrow = borrows >> 8;
+
+            const __m256i in = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32((int)borrows), bits), bits);
+            diff = _mm256_add_epi32(diff, in);
+            diff = _mm256_add_epi32(diff, _mm256_and_si256(_mm256_cmpgt_epi32(zero, diff), base));
+            _mm256_storeu_si256((__m256i*)(result + i), diff);
+        }
+        return borrow;
+    }
+
+    __attribute__((target("avx2")))
+    static size_t _CompareLimbsAvx2(const unsigned int* lhs, const unsigned int* rhs, size_t count)
+    {
+        // the number of limbs, from the top, that are the same.
+        size_t i = count;
+        for (; i >= 8; i -= 8)
+        {
+            const __m256i same = _mm256_cmpeq_epi32(_mm256_loadu_si256((const __m256i*)(lhs + i - 8)), _mm256_loadu_si256((const __m256i*)(rhs + i - 8)));
+            const unsigned int mask = (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(same));
+            if (mask != 0xFF)
+            {
+                // the highest limb that is not the same.
+                return i - 8 + (31 - __builtin_clz(~mask & 0xFF)) + 1;
+            }
+        }
+        return i;
+    }
+
+    __attribute__((target("sse2")))
+    static unsigned int _AddLimbsSse2(unsigned int* result, const unsigned int* lhs, const unsigned int* rhs, size_t count, unsigned int carry)
+    {
+        const __m128i max = _mm_set1_epi32(BIGNUMBER_LIMB_BASE - 1);
+        const __m128i base = _mm_set1_epi32(BIGNUMBER_LIMB_BASE);
+        const __m128i bits = _mm_setr_epi32(1, 2, 4, 8);
+        for (size_t i = 0; i + 4 <= count; i += 4)
+        {
+            __m128i sum = _mm_add_epi32(_mm_loadu_si128((const __m128i*)(lhs + i)), _mm_loadu_si128((const __m128i*)(rhs + i)));
+            const unsigned int generate = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(sum, max)));
+            const unsigned int propagate = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(sum, max)));
+            const unsigned int carries = (((generate << 1) | carry) + propagate) ^ propagate;
+            carry = carries >> 4;
+
+            const __m128i in = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32((int)carries), bits), bits);
+            sum = _mm_sub_epi32(sum, in);
+            sum = _mm_sub_epi32(sum, _mm_and_si128(_mm_cmpgt_epi32(sum, max), base));
+            _mm_storeu_si128((__m128i*)(result + i), sum);
+        }
+        return carry;
+    }
+
+    __attribute__((target("sse2")))
+    static unsigned int _SubLimbsSse2(unsigned int* result, const unsigned int* lhs, const unsigned int* rhs, size_t count, unsigned int borrow)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i base = _mm_set1_epi32(BIGNUMBER_LIMB_BASE);
+        const __m128i bits = _mm_setr_epi32(1, 2, 4, 8);
+        for (size_t i = 0; i + 4 <= count; i += 4)
+        {
+            __m128i diff = _mm_sub_epi32(_mm_loadu_si128((const __m128i*)(lhs + i)), _mm_loadu_si128((const __m128i*)(rhs + i)));
+            const unsigned int generate = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(zero, diff)));
+            const unsigned int propagate = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(diff, zero)));
+            const unsigned int borrows = (((generate << 1) | borrow) + propagate) ^ propagate;
+            borrow = borrows >> 4;
+
+            const __m128i in = _mm_cmpeq_epi32(_mm_and_si128(_mm_set1_epi32((int)borrows), bits), bits);
+            diff = _mm_add_epi32(diff, in);
+            diff = _mm_add_epi32(diff, _mm_and_si128(_mm_cmpgt_epi32(zero, diff), base));
+            _mm_storeu_si128((__m128i*)(result + i), diff);
+        }
+        return borrow;
+    }
+
+    __attribute__((target("sse2")))
+    static size_t _CompareLimbsSse2(const unsigned int* lhs, const unsigned int* rhs, size_t count)
+    {
+        size_t i = count;
+        for (; i >= 4; i -= 4)
+        {
+            const __m128i same = _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i*)(lhs + i - 4)), _mm_loadu_si128((const __m128i*)(rhs + i - 4)));
+            const unsigned int mask = (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(same));
+            if (mask != 0xF)
+            {
+                return i - 4 + (31 - __builtin_clz(~mask & 0xF)) + 1;
+            }
+        }
+        return i;
+    }
+
+    // what the cpu we are running on can do, 2 = AVX2, 1 = SSE2 and 0 = neither.
+    static int _SimdLevel()
+    {
+        static const int level = []()
+        {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return 2;
+            }
+            return __builtin_cpu_supports("sse2") ? 1 : 0;
+        }();
+        return level;
+    }
+#endif
+
+    /**
+     * result = lhs + rhs + carry, for 'count' limbs, result can be lhs or rhs.
+     * Long runs of limbs use the vector instructions of the cpu, if it has any.
+     * @param unsigned int* result where we save the sum.
+     * @param const unsigned int* lhs the first number.
+     * @param const unsigned int* rhs the second number.
+     * @param size_t count the number of limbs.
+     * @param unsigned int carry the carry in, (0 or 1).
+     * @return unsigned int the carry out, (0 or 1).
+     */
+    unsigned int BigNumber::_AddLimbsKernel(unsigned int* result, const unsigned int* lhs, const unsigned int* rhs, size_t count, unsigned int carry)
+    {
+        size_t i = 0;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        if (count >= BIGNUMBER_SIMD_LIMBS)
+        {
+            const int level = _SimdLevel();
+            if (level == 2)
+            {
+                carry = _AddLimbsAvx2(result, lhs, rhs, count, carry);
+                i = count - count % 8;
+            }
+            else if (level == 1)
+            {
+                carry = _AddLimbsSse2(result, lhs, rhs, count, carry);
+                i = count - count % 4;
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            unsigned int sum = lhs[i] + rhs[i] + carry;
+
+            carry = 0;
+            if (sum >= BIGNUMBER_LIMB_BASE)
+            {
+                sum -= BIGNUMBER_LIMB_BASE;
+                carry = 1;
+            }
+            result[i] = sum;
+        }
+        return carry;
+    }
+
+    /**
+     * result = lhs - rhs - borrow, for 'count' limbs, result can be lhs or rhs.
+     * Long runs of limbs use the vector instructions of the cpu, if it has any.
+     * @param unsigned int* result where we save the difference.
+     * @param const unsigned int* lhs the number we subtract from.
+     * @param const unsigned int* rhs the number we subtract.
+     * @param size_t count the number of limbs.
+     * @param unsigned int borrow the borrow in, (0 or 1).
+     * @return unsigned int the borrow out, (0 or 1).
+     */
+    unsigned int BigNumber::_SubLimbsKernel(unsigned int* result, const unsigned int* lhs, const unsigned int* rhs, size_t count, unsigned int borrow)
+    {
+        size_t i = 0;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        if (count >= BIGNUMBER_SIMD_LIMBS)
+        {
+            const int level = _SimdLevel();
+            if (level == 2)
+            {
+                borrow = _SubLimbsAvx2(result, lhs, rhs, count, borrow);
+                i = count - count % 8;
+            }
+            else if (level == 1)
+            {
+                borrow = _SubLimbsSse2(result, lhs, rhs, count, borrow);
+                i = count - count % 4;
+            }
+        }
+#endif
+        for (; i < count; ++i)
+        {
+            const unsigned int small = rhs[i] + borrow;
+
+            borrow = 0;
+            if (lhs[i] < small)
+            {
+                result[i] = lhs[i] + BIGNUMBER_LIMB_BASE - small;
+                borrow = 1;
+            }
+            else
+            {
+                result[i] = lhs[i] - small;
+            }
+        }
+        return borrow;
+    }
+
+    /**
+     * Compare 'count' limbs, starting with the biggest ones.
+     * Long runs of limbs use the vector instructions of the cpu, if it has any.
+     * @param const unsigned int* lhs the left hand side limbs
+     * @param const unsigned int* rhs the right hand side limbs
+     * @param size_t count the number of limbs.
+     * @return int -ve rhs is greater, +ve lhs is greater and 0 = they are equal.
+     */
+    int BigNumber::_CompareLimbsKernel(const unsigned int* lhs, const unsigned int* rhs, size_t count)
+    {
+        size_t i = count;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        if (count >= BIGNUMBER_SIMD_LIMBS)
+        {
+            // skip the limbs that are the same.
+            const int level = _SimdLevel();
+            if (level == 2)
+            {
+                i = _CompareLimbsAvx2(lhs, rhs, count);
+            }
+            else if (level == 1)
+            {
+                i = _CompareLimbsSse2(lhs, rhs, count);
+            }
+        }
+#endif
+        for (; i > 0; --i)
+        {
+            if (lhs[i - 1] != rhs[i - 1])
+            {
+                return lhs[i - 1] > rhs[i - 1] ? 1 : -1;
+            }
+        }
+
+        // they are the same
+        return 0;
+    }
+
+    /**
+     * Compare 2 limbs numbers, they both have to have the same number of decimals.
+     * @param const LIMBS& lhs the left hand side number
+     * @param const LIMBS& rhs the right hand size number
+     * @return int -ve rhs is greater, +ve lhs is greater and 0 = they are equal.
+     */
+    int BigNumber::_CompareLimbs(const LIMBS& lhs, const LIMBS& rhs)
+    {
+        // there are no leading zeros, so the longest number is the biggest.
+        if (lhs.size() != rhs.size())
+        {
+            return lhs.size() > rhs.size() ? 1 : -1;
+        }
+
+        // otherwise compare the biggest limbs first.
+        return BigNumber::_CompareLimbsKernel(lhs.begin(), rhs.begin(), lhs.size());
+    }
+
+    /**
+     * Add 2 limbs numbers together, they both have to have the same number of decimals.
+     * @param const LIMBS& lhs the number been Added from
+     * @param const LIMBS& rhs the number been Added with.
+     * @param LIMBS& result the sum of the two numbers.
+     */
+    void BigNumber::_AddLimbs(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result)
+    {
+        // if they both fit in 64 bits, the sum cannot overflow, (10^18 + 10^18 < 2^64).
+        unsigned long long l, r;
+        if (BigNumber::_LimbsToULongLong(lhs, l) && BigNumber::_LimbsToULongLong(rhs, r))
+        {
+            BigNumber::_ULongLongToLimbs(l + r, result);
+            return;
+        }
+
+        const LIMBS& longest = lhs.size() >= rhs.size() ? lhs : rhs;
+        const LIMBS& shortest = lhs.size() >= rhs.size() ? rhs : lhs;
+        const size_t size = longest.size();
+        const size_t common = shortest.size();
+
+        result.resize(size);
+
+        // add the limbs both numbers have, then carry over the rest of the longest.
+        unsigned int carryOver = BigNumber::_AddLimbsKernel(result.begin(), longest.begin(), shortest.begin(), common, 0);
+        for (size_t i = common; i < size; ++i)
+        {
+            unsigned int sum = longest[i] + carryOver;
+
+            carryOver = 0;
+            if (sum >= BIGNUMBER_LIMB_BASE)
+            {
+                sum -= BIGNUMBER_LIMB_BASE;
+                carryOver = 1;
+            }
+            result[i] = sum;
+        }
+
+        if (carryOver > 0)
+        {
+            result.push_back(carryOver);
+        }
+    }
+
+    /**
+     * Subtract 2 limbs numbers, they both have to have the same number of decimals.
+     * and lhs has to be greater or equal to rhs.
+     * @param const LIMBS& lhs the number been subtracted from
+     * @param const LIMBS& rhs the number been subtracted with.
+     * @param LIMBS& result the diff of the two numbers.
+     */
+    void BigNumber::_SubLimbs(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result)
+    {
+        unsigned long long l, r;
+        if (BigNumber::_LimbsToULongLong(lhs, l) && BigNumber::_LimbsToULongLong(rhs, r))
+        {
+            BigNumber::_ULongLongToLimbs(l - r, result);
+            return;
+        }
+
+        const size_t size = lhs.size();
+        const size_t common = rhs.size();
+        result.resize(size);
+
+        // subtract the limbs both numbers have, then carry over the rest of lhs.
+        unsigned int carryOver = BigNumber::_SubLimbsKernel(result.begin(), lhs.begin(), rhs.begin(), common, 0);
+        for (size_t i = common; i < size; ++i)
+        {
+            if (lhs[i] < carryOver)
+            {
+                result[i] = lhs[i] + BIGNUMBER_LIMB_BASE - carryOver;
+            }
+            else
+            {
+                result[i] = lhs[i] - carryOver;
+                carryOver = 0;
+            }
+        }
+
+        // remove the leading zeros.
+        while (!result.empty() && result.back() == 0)
+        {
+            result.pop_back();
+        }
+    }
+
+    /**
+     * Add 2 limbs numbers together, lhs += rhs, they both have to have the same number of decimals.
+     * We stop as soon as there is nothing left to carry, so adding 1 to a big number is quick.
+     * @param LIMBS& lhs the number been Added to, (it can be the same as rhs).
+     * @param const LIMBS& rhs the number been Added with.
+     */
+    void BigNumber::_AddLimbsAssign(LIMBS& lhs, const LIMBS& rhs)
+    {
+        unsigned long long l, r;
+        if (BigNumber::_LimbsToULongLong(lhs, l) && BigNumber::_LimbsToULongLong(rhs, r))
+        {
+            BigNumber::_ULongLongToLimbs(l + r, lhs);
+            return;
+        }
+
+        const size_t size = rhs.size();
+        if (lhs.size() < size)
+        {
+            lhs.resize(size, 0);
+        }
+
+        // add the limbs of rhs, then carry over until there is nothing left to carry.
+        unsigned int carryOver = BigNumber::_AddLimbsKernel(lhs.begin(), lhs.begin(), rhs.begin(), size, 0);
+        for (size_t i = size; carryOver > 0 && i < lhs.size(); ++i)
+        {
+            unsigned int sum = lhs[i] + carryOver;
+
+            carryOver = 0;
+            if (sum >= BIGNUMBER_LIMB_BASE)
+            {
+                sum -= BIGNUMBER_LIMB_BASE;
+                carryOver = 1;
+            }
+            lhs[i] = sum;
+        }
+
+        if (carryOver > 0)
+        {
+            lhs.push_back(carryOver);
+        }
+    }
+
+    /**
+     * Subtract 2 limbs numbers, lhs = |lhs - rhs|, they both have to have the same number of decimals.
+     * @param LIMBS& lhs the number been subtracted from, (it can be the same as rhs).
+     * @param const LIMBS& rhs the number been subtracted with.
+     */
+    void BigNumber::_SubLimbsAssign(LIMBS& lhs, const LIMBS& rhs)
+    {
+        unsigned long long l, r;
+        if (BigNumber::_LimbsToULongLong(lhs, l) && BigNumber::_LimbsToULongLong(rhs, r))
+        {
+            BigNumber::_ULongLongToLimbs(l >= r ? l - r : r - l, lhs);
+            return;
+        }
+
+        // if rhs is bigger, then we do rhs - lhs instead
+        // they cannot be the same limbs in that case.
+        const bool reverse = (BigNumber::_CompareLimbs(lhs, rhs) < 0);
+        if (reverse)
+        {
+            lhs.resize(rhs.size(), 0);
+        }
+
+        if (reverse)
+        {
+            // lhs = rhs - lhs, they are now the same size and rhs is bigger, so nothing is left to carry over.
+            BigNumber::_SubLimbsKernel(lhs.begin(), rhs.begin(), lhs.begin(), lhs.size(), 0);
+        }
+        else
+        {
+            // subtract the limbs of rhs, then carry over until there is nothing more to subtract.
+            unsigned int carryOver = BigNumber::_SubLimbsKernel(lhs.begin(), lhs.begin(), rhs.begin(), rhs.size(), 0);
+            for (size_t i = rhs.size(); carryOver > 0 && i < lhs.size(); ++i)
+            {
+                if (lhs[i] == 0)
+                {
+                    lhs[i] = BIGNUMBER_LIMB_BASE - 1;
+                }
+                else
+                {
+                    --lhs[i];
+                    carryOver = 0;
+                }
+            }
+        }
+
+        // remove the leading zeros.
+        while (!lhs.empty() && lhs.back() == 0)
+        {
+            lhs.pop_back();
+        }
+    }
+
+    /**
+     * Multiply 2 limbs numbers, (the decimals of the result are the decimals of both numbers).
+     * @param const LIMBS& lhs the number been multiplied
+     * @param const LIMBS& rhs the number multipling
+     * @param LIMBS& result the product of the two numbers.
+     */
+    void BigNumber::_MulLimbs(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result)
+    {
+        result.clear();
+        if (lhs.empty() || rhs.empty())
+        {
+            // zero * anything = zero.
+            return;
+        }
+
+        // if the product still fits in 64 bits, we can use it as it is.
+        unsigned long long l, r;
+        if (BigNumber::_LimbsToULongLong(lhs, l) && BigNumber::_LimbsToULongLong(rhs, r) && l <= std::numeric_limits<unsigned long long>::max() / r)
+        {
+            BigNumber::_ULongLongToLimbs(l * r, result);
+            return;
+        }
+
+        const LIMBS& longest = lhs.size() >= rhs.size() ? lhs : rhs;
+        const LIMBS& shortest = lhs.size() >= rhs.size() ? rhs : lhs;
+
+        // small numbers are faster the long way.
+        if (shortest.size() < BIGNUMBER_KARATSUBA_LIMBS)
+        {
+            BigNumber::_MulLimbsSchoolbook(lhs, rhs, result);
+            return;
+        }
+
+        // if one number is a lot bigger than the other, split it in pieces the size of the smaller one
+        // 123456 * 78 = (1200 * 78) + (3400 * 78) + (56 * 78)
+        // so that each piece can use the faster ways.
+        if (longest.size() >= 2 * shortest.size())
+        {
+            LIMBS piece, product;
+            for (size_t i = 0; i < longest.size(); i += shortest.size())
+            {
+                BigNumber::_SliceLimbs(longest, i, shortest.size(), piece);
+                BigNumber::_MulLimbs(piece, shortest, product);
+                BigNumber::_AddLimbsAt(result, product, i);
+            }
+            return;
+        }
+
+        if (shortest.size() < BIGNUMBER_TOOM3_LIMBS)
+        {
+            BigNumber::_MulLimbsKaratsuba(lhs, rhs, result);
+            return;
+        }
+        BigNumber::_MulLimbsToom3(lhs, rhs, result);
+    }
+
+    /**
+     * Multiply 2 limbs numbers the long way, in O(n*m)
+     * @see _MulLimbs( ... )
+     * @param const LIMBS& lhs the number been multiplied
+     * @param const LIMBS& rhs the number multipling
+     * @param LIMBS& result the product of the two numbers.
+     */
+    void BigNumber::_MulLimbsSchoolbook(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result)
+    {
         //  15 * 25  = 5*5             = 25 = push(5) carry_over = 2
         //           = 5*1+ccarry_over =  7 = push(7) carry_over = 0
         //           = 75
@@ -766,317 +1864,903 @@ namespace MyOddWeb
         //           = 2*1+ccarry_over =  3 = push(3) carry_over = 0
         //           = 30 * BIGNUMBER_BASE
         //           = 300+75=375
+        // but we do it a limb at a time rather than a number at a time.
+        result.resize(lhs.size() + rhs.size(), 0);
+        for (size_t x = 0; x < lhs.size(); ++x)
+        {
+            const unsigned long long lhs_number = lhs[x];
+            if (lhs_number == 0)
+            {
+                continue;
+            }
 
-        // the two sizes
-        const size_t ll = lhs._numbers.size();
-        const size_t rl = rhs._numbers.size();
+            // and the carry over.
+            unsigned long long carryOver = 0;
+            for (size_t y = 0; y < rhs.size(); ++y)
+            {
+                unsigned long long sum = lhs_number * rhs[y] + result[x + y] + carryOver;
+                result[x + y] = (unsigned int)(sum % BIGNUMBER_LIMB_BASE);
+                carryOver = sum / BIGNUMBER_LIMB_BASE;
+            }
+            result[x + rhs.size()] = (unsigned int)carryOver;
+        }
 
-        // the return number
-        BigNumber c;
-        static const size_t shift = 4;           // max int = 2147483647 on a 32 bit process
-                                                 // so the biggest number we can have is 46340 (46340*46340=2147395600)
-                                                 // so using 1 and 0 only, the biggest number is 10000 (and shift=4xzeros)
-                                                 // the biggest number is 9999*9999= 99980001
-        static unsigned long long max_base = 10000;
+        // remove the leading zeros.
+        while (!result.empty() && result.back() == 0)
+        {
+            result.pop_back();
+        }
+    }
 
-        NUMBERS shifts;
-        for (size_t x = 0; x < ll; x += shift)
+    /**
+     * Multiply 2 limbs numbers using Karatsuba, in O(n^1.58)
+     * @see https://en.wikipedia.org/wiki/Karatsuba_algorithm
+     * @param const LIMBS& lhs the number been multiplied
+     * @param const LIMBS& rhs the number multipling
+     * @param LIMBS& result the product of the two numbers.
+     */
+    void BigNumber::_MulLimbsKaratsuba(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result)
+    {
+        // split both numbers in 2, x = BIGNUMBER_LIMB_BASE^half
+        // lhs = l1*x + l0
+        // rhs = r1*x + r0
+        const size_t half = ((lhs.size() >= rhs.size() ? lhs.size() : rhs.size()) + 1) / 2;
+        LIMBS l0, l1, r0, r1;
+        BigNumber::_SliceLimbs(lhs, 0, half, l0);
+        BigNumber::_SliceLimbs(lhs, half, lhs.size(), l1);
+        BigNumber::_SliceLimbs(rhs, 0, half, r0);
+        BigNumber::_SliceLimbs(rhs, half, rhs.size(), r1);
+
+        // z0 = l0*r0
+        // z2 = l1*r1
+        // z1 = (l0+l1)*(r0+r1) - z0 - z2
+        LIMBS z0, z1, z2, lsum, rsum, product;
+        BigNumber::_MulLimbs(l0, r0, z0);
+        BigNumber::_MulLimbs(l1, r1, z2);
+        BigNumber::_AddLimbs(l0, l1, lsum);
+        BigNumber::_AddLimbs(r0, r1, rsum);
+        BigNumber::_MulLimbs(lsum, rsum, product);
+        BigNumber::_SubLimbs(product, z0, z1);
+        BigNumber::_SubLimbs(z1, z2, product);
+
+        // result = z2*x^2 + z1*x + z0
+        result = z0;
+        BigNumber::_AddLimbsAt(result, product, half);
+        BigNumber::_AddLimbsAt(result, z2, 2 * half);
+    }
+
+    /**
+     * Multiply 2 limbs numbers using Toom-Cook 3 way, in O(n^1.46)
+     * The evaluation and interpolation follows Bodrato's sequence, with the points 0, 1, -1, -2 and infinity.
+     * We use BigNumber integers for the parts as some of them can be negative.
+     * @see https://en.wikipedia.org/wiki/Toom%E2%80%93Cook_multiplication
+     * @param const LIMBS& lhs the number been multiplied
+     * @param const LIMBS& rhs the number multipling
+     * @param LIMBS& result the product of the two numbers.
+     */
+    void BigNumber::_MulLimbsToom3(const LIMBS& lhs, const LIMBS& rhs, LIMBS& result)
+    {
+        // split both numbers in 3, x = BIGNUMBER_LIMB_BASE^third
+        // lhs = l2*x^2 + l1*x + l0
+        // rhs = r2*x^2 + r1*x + r0
+        const size_t third = ((lhs.size() >= rhs.size() ? lhs.size() : rhs.size()) + 2) / 3;
+        BigNumber l0, l1, l2, r0, r1, r2;
+        BigNumber::_SliceLimbs(lhs, 0, third, l0._limbs);
+        BigNumber::_SliceLimbs(lhs, third, third, l1._limbs);
+        BigNumber::_SliceLimbs(lhs, 2 * third, lhs.size(), l2._limbs);
+        BigNumber::_SliceLimbs(rhs, 0, third, r0._limbs);
+        BigNumber::_SliceLimbs(rhs, third, third, r1._limbs);
+        BigNumber::_SliceLimbs(rhs, 2 * third, rhs.size(), r2._limbs);
+        l0.PerformPostOperations(0); l1.PerformPostOperations(0); l2.PerformPostOperations(0);
+        r0.PerformPostOperations(0); r1.PerformPostOperations(0); r2.PerformPostOperations(0);
+
+        // evaluate both numbers at 0, 1, -1, -2 and infinity
+        //   p(0) = p0, p(1) = p0+p1+p2, p(-1) = p0-p1+p2, p(-2) = (p(-1)+p2)*2-p0, p(inf) = p2
+        BigNumber lone = BigNumber(l0).Add(l2);
+        BigNumber lminusone = BigNumber(lone).Sub(l1);
+        lone.Add(l1);
+        BigNumber lminustwo = BigNumber(lminusone).Add(l2);
+        lminustwo.Add(BigNumber(lminustwo)).Sub(l0);
+
+        BigNumber rone = BigNumber(r0).Add(r2);
+        BigNumber rminusone = BigNumber(rone).Sub(r1);
+        rone.Add(r1);
+        BigNumber rminustwo = BigNumber(rminusone).Add(r2);
+        rminustwo.Add(BigNumber(rminustwo)).Sub(r0);
+
+        // multiply the values at each point.
+        BigNumber w0, w1, wminusone, wminustwo, winf;
+        BigNumber::_MulLimbs(l0._limbs, r0._limbs, w0._limbs);
+        BigNumber::_MulLimbs(lone._limbs, rone._limbs, w1._limbs);
+        BigNumber::_MulLimbs(lminusone._limbs, rminusone._limbs, wminusone._limbs);
+        BigNumber::_MulLimbs(lminustwo._limbs, rminustwo._limbs, wminustwo._limbs);
+        BigNumber::_MulLimbs(l2._limbs, r2._limbs, winf._limbs);
+        wminusone._neg = (lminusone.IsNeg() != rminusone.IsNeg());
+        wminustwo._neg = (lminustwo.IsNeg() != rminustwo.IsNeg());
+        w0.PerformPostOperations(0); w1.PerformPostOperations(0); winf.PerformPostOperations(0);
+        wminusone.PerformPostOperations(0); wminustwo.PerformPostOperations(0);
+
+        // interpolate the 5 parts of the result, all the divisions are exact.
+        //   c3 = (w(-2) - w(1)) / 3
+        //   c1 = (w(1) - w(-1)) / 2
+        //   c2 = w(-1) - w(0)
+        //   c3 = (c2 - c3) / 2 + 2*w(inf)
+        //   c2 = c2 + c1 - w(inf)
+        //   c1 = c1 - c3
+        BigNumber c3 = BigNumber(wminustwo).Sub(w1);
+        BigNumber::_DevideLimbs(c3._limbs, 3);
+        BigNumber c1 = BigNumber(w1).Sub(wminusone);
+        BigNumber::_DevideLimbs(c1._limbs, 2);
+        BigNumber c2 = BigNumber(wminusone).Sub(w0);
+        c3 = BigNumber(c2).Sub(c3.PerformPostOperations(0));
+        BigNumber::_DevideLimbs(c3._limbs, 2);
+        c3.PerformPostOperations(0).Add(winf).Add(winf);
+        c2.Add(c1.PerformPostOperations(0)).Sub(winf);
+        c1.Sub(c3);
+
+        // result = c4*x^4 + c3*x^3 + c2*x^2 + c1*x + c0, and they are all positive.
+        result = w0._limbs;
+        BigNumber::_AddLimbsAt(result, c1._limbs, third);
+        BigNumber::_AddLimbsAt(result, c2._limbs, 2 * third);
+        BigNumber::_AddLimbsAt(result, c3._limbs, 3 * third);
+        BigNumber::_AddLimbsAt(result, winf._limbs, 4 * third);
+    }
+
+    /**
+     * Copy part of a number, the limbs [from, from+count).
+     * @param const LIMBS& limbs the number we are copying from.
+     * @param size_t from the first limb we want.
+     * @param size_t count the maximum number of limbs we want.
+     * @param LIMBS& part the part we copied, without leading zeros.
+     */
+    void BigNumber::_SliceLimbs(const LIMBS& limbs, size_t from, size_t count, LIMBS& part)
+    {
+        part.clear();
+        if (from >= limbs.size())
         {
-            // this number
-            NUMBERS numbers;
+            return;
+        }
+        const size_t to = (limbs.size() - from < count) ? limbs.size() : from + count;
+        part.resize(to - from);
+        std::memcpy(&part[0], &limbs[from], (to - from) * sizeof(unsigned int));
 
-            // and the carry over.
-            unsigned long long carryOver = 0;
+        // remove the leading zeros.
+        while (!part.empty() && part.back() == 0)
+        {
+            part.pop_back();
+        }
+    }
 
-            // get the numbers.
-            unsigned long long lhs_number = lhs._MakeNumberAtIndex(x, shift);
+    /**
+     * Add a number to the limbs, starting at a given limb, result += number * BIGNUMBER_LIMB_BASE^offset
+     * @param LIMBS& result the number we are adding to.
+     * @param const LIMBS& number the number we are adding.
+     * @param size_t offset where we start adding the number.
+     */
+    void BigNumber::_AddLimbsAt(LIMBS& result, const LIMBS& number, size_t offset)
+    {
+        if (number.empty())
+        {
+            return;
+        }
+        if (result.size() < offset + number.size())
+        {
+            result.resize(offset + number.size(), 0);
+        }
+
+        // add the number, then carry over until there is nothing left to carry.
+        unsigned int carryOver = BigNumber::_AddLimbsKernel(result.begin() + offset, result.begin() + offset, number.begin(), number.size(), 0);
+        for (size_t i = offset + number.size(); carryOver > 0; ++i)
+        {
+            if (i == result.size())
+            {
+                result.push_back(0);
+            }
+            unsigned int sum = result[i] + carryOver;
+
+            carryOver = 0;
+            if (sum >= BIGNUMBER_LIMB_BASE)
+            {
+                sum -= BIGNUMBER_LIMB_BASE;
+                carryOver = 1;
+            }
+            result[i] = sum;
+        }
+    }
+
+    /**
+     * Devide limbs by a number that fits in a limb.
+     * @param LIMBS& limbs the number we are dividing, it becomes the quotient.
+     * @param unsigned int divisor the number we are dividing by, it cannot be zero.
+     * @return unsigned int the remainder.
+     */
+    unsigned int BigNumber::_DevideLimbs(LIMBS& limbs, unsigned int divisor)
+    {
+        unsigned long long remainder = 0;
+        for (size_t i = limbs.size(); i > 0; --i)
+        {
+            unsigned long long number = remainder * BIGNUMBER_LIMB_BASE + limbs[i - 1];
+            limbs[i - 1] = (unsigned int)(number / divisor);
+            remainder = number % divisor;
+        }
+
+        // remove the leading zeros.
+        while (!limbs.empty() && limbs.back() == 0)
+        {
+            limbs.pop_back();
+        }
+        return (unsigned int)remainder;
+    }
+
+    /**
+     * Multiply limbs by a number that fits in a limb and add other limbs, in one pass.
+     * limbs = limbs * multiplier + addend, (both numbers have the same number of decimals).
+     * Every step is at most (10^9-1)^2 + 2 x (10^9-1) < 10^18 so the carry always fits in a limb.
+     * @param LIMBS& limbs the number we are multiplying, it becomes the result.
+     * @param unsigned int multiplier the number we are multiplying by.
+     * @param const LIMBS& addend the number we are adding, it cannot be the same limbs.
+     */
+    void BigNumber::_MulAddLimbs(LIMBS& limbs, unsigned int multiplier, const LIMBS& addend)
+    {
+        if (limbs.size() < addend.size())
+        {
+            limbs.resize(addend.size(), 0);
+        }
+
+        unsigned long long carryOver = 0;
+        for (size_t i = 0; i < limbs.size(); ++i)
+        {
+            unsigned long long sum = (unsigned long long)limbs[i] * multiplier + carryOver;
+            if (i < addend.size())
+            {
+                sum += addend[i];
+            }
+            limbs[i] = (unsigned int)(sum % BIGNUMBER_LIMB_BASE);
+            carryOver = sum / BIGNUMBER_LIMB_BASE;
+        }
+        if (carryOver > 0)
+        {
+            limbs.push_back((unsigned int)carryOver);
+        }
+
+        // the multiplier could have been zero.
+        while (!limbs.empty() && limbs.back() == 0)
+        {
+            limbs.pop_back();
+        }
+    }
+
+    /**
+     * Divide 2 limbs numbers, quotient = numerator / denominator and remainder = numerator % denominator
+     * Depending on the size of the denominator we use a short division, (a single limb),
+     * Knuth's algorithm D or, for big numbers, a Newton iteration on the reciprocal of the denominator.
+     * The quotient and remainder cannot be the same limbs as the numerator or the denominator.
+     * @param const LIMBS& numerator the number been divided.
+     * @param const LIMBS& denominator the number dividing, it cannot be zero.
+     * @param LIMBS& quotient the quotient of the division.
+     * @param LIMBS* remainder the remainder, (if we want it).
+     */
+    void BigNumber::_DivModLimbs(const LIMBS& numerator, const LIMBS& denominator, LIMBS& quotient, LIMBS* remainder)
+    {
+        // if the denominator is bigger then there is nothing to divide.
+        if (BigNumber::_CompareLimbs(numerator, denominator) < 0)
+        {
+            quotient.clear();
+            if (remainder != NULL)
+            {
+                *remainder = numerator;
+            }
+            return;
+        }
+
+        // if the denominator fits in a single limb, we can do a short division
+        // in one pass, carrying the remainder down from one limb to the next.
+        if (denominator.size() == 1)
+        {
+            quotient = numerator;
+            const unsigned int r = BigNumber::_DevideLimbs(quotient, denominator[0]);
+            if (remainder != NULL)
+            {
+                BigNumber::_ULongLongToLimbs(r, *remainder);
+            }
+            return;
+        }
+
+        // the Newton iteration is made of multiplications, so it is only worth it
+        // if both the denominator and the quotient are big.
+        const size_t quotientSize = numerator.size() - denominator.size() + 1;
+        if (denominator.size() >= BIGNUMBER_NEWTON_LIMBS && quotientSize >= BIGNUMBER_NEWTON_LIMBS / 3)
+        {
+            BigNumber::_DivModLimbsNewton(numerator, denominator, quotient, remainder);
+            return;
+        }
+        BigNumber::_DivModLimbsKnuth(numerator, denominator, quotient, remainder);
+    }
+
+    /**
+     * Divide 2 limbs numbers using Knuth's algorithm D, in O(n*m)
+     * The denominator has at least 2 limbs and is not greater than the numerator.
+     * @see https://en.wikipedia.org/wiki/Division_algorithm#Long_division
+     * @see _DivModLimbs( ... )
+     * @param const LIMBS& numerator the number been divided.
+     * @param const LIMBS& denominator the number dividing.
+     * @param LIMBS& quotient the quotient of the division.
+     * @param LIMBS* remainder the remainder, (if we want it).
+     */
+    void BigNumber::_DivModLimbsKnuth(const LIMBS& numerator, const LIMBS& denominator, LIMBS& quotient, LIMBS* remainder)
+    {
+        const size_t n = denominator.size();
+        const size_t m = numerator.size() - n;
+
+        // multiply both numbers so the top limb of the denominator is at least half the base
+        // that way our guess of each limb of the quotient is never more than 2 away.
+        const unsigned int factor = (unsigned int)(BIGNUMBER_LIMB_BASE / ((unsigned long long)denominator.back() + 1));
+        LIMBS u(numerator);
+        LIMBS v(denominator);
+        unsigned long long carryOver = 0;
+        for (size_t i = 0; i < u.size(); ++i)
+        {
+            const unsigned long long number = (unsigned long long)u[i] * factor + carryOver;
+            u[i] = (unsigned int)(number % BIGNUMBER_LIMB_BASE);
+            carryOver = number / BIGNUMBER_LIMB_BASE;
+        }
+        u.push_back((unsigned int)carryOver);
+        carryOver = 0;
+        for (size_t i = 0; i < v.size(); ++i)
+        {
+            const unsigned long long number = (unsigned long long)v[i] * factor + carryOver;
+            v[i] = (unsigned int)(number % BIGNUMBER_LIMB_BASE);
+            carryOver = number / BIGNUMBER_LIMB_BASE;
+        }
+
+        const unsigned long long top = v[n - 1];
+        const unsigned long long next = v[n - 2];
+        quotient.assign(m + 1, 0);
+        for (size_t j = m + 1; j > 0; --j)
+        {
+            const size_t k = j - 1;
+
+            // guess the limb from the top 2 limbs of the remainder and the top limb of the denominator.
+            const unsigned long long number = (unsigned long long)u[k + n] * BIGNUMBER_LIMB_BASE + u[k + n - 1];
+            unsigned long long guess = number / top;
+            unsigned long long rest = number % top;
+            while (guess >= BIGNUMBER_LIMB_BASE || guess * next > rest * BIGNUMBER_LIMB_BASE + u[k + n - 2])
+            {
+                --guess;
+                rest += top;
+                if (rest >= BIGNUMBER_LIMB_BASE)
+                {
+                    break;
+                }
+            }
 
-            for (size_t y = 0; y < rl; y += shift)
+            // remove guess * denominator from the remainder.
+            unsigned long long product = 0;
+            unsigned int borrow = 0;
+            for (size_t i = 0; i < n; ++i)
             {
-                unsigned long long rhs_number = rhs._MakeNumberAtIndex(y, shift);
-                unsigned long long sum = lhs_number * rhs_number + carryOver;
-                carryOver = static_cast<unsigned long long>(sum / max_base);
-
-                for (size_t z = 0; z < shift; ++z)
+                product = guess * v[i] + product / BIGNUMBER_LIMB_BASE;
+                const unsigned int small = (unsigned int)(product % BIGNUMBER_LIMB_BASE) + borrow;
+                borrow = 0;
+                if (u[k + i] < small)
                 {
-                    unsigned char s = sum % BIGNUMBER_BASE;
-                    numbers.push_back(s);
-
-                    sum = static_cast<unsigned long long>(sum / BIGNUMBER_BASE);
+                    u[k + i] = u[k + i] + BIGNUMBER_LIMB_BASE - small;
+                    borrow = 1;
+                }
+                else
+                {
+                    u[k + i] -= small;
                 }
             }
-
-            // add the carry over if we have one
-            while (carryOver > 0)
+            const unsigned int small = (unsigned int)(product / BIGNUMBER_LIMB_BASE) + borrow;
+            if (u[k + n] >= small)
             {
-                unsigned char s = carryOver % BIGNUMBER_BASE;
-                numbers.push_back(s);
-                carryOver = static_cast<unsigned long long>(carryOver / BIGNUMBER_BASE);
+                u[k + n] -= small;
             }
-
-            // shift everything
-            numbers.insert(numbers.begin(), shifts.begin(), shifts.end());
-
-            for (unsigned int z = 0; z < shift; ++z) {
-                shifts.push_back(0);
+            else
+            {
+                // we removed one denominator too many, so we add it back.
+                u[k + n] = u[k + n] + BIGNUMBER_LIMB_BASE - small;
+                --guess;
+                unsigned int carry = 0;
+                for (size_t i = 0; i < n; ++i)
+                {
+                    unsigned int sum = u[k + i] + v[i] + carry;
+                    carry = 0;
+                    if (sum >= BIGNUMBER_LIMB_BASE)
+                    {
+                        sum -= BIGNUMBER_LIMB_BASE;
+                        carry = 1;
+                    }
+                    u[k + i] = sum;
+                }
+                u[k + n] = (u[k + n] + carry) % BIGNUMBER_LIMB_BASE;
             }
+            quotient[k] = (unsigned int)guess;
+        }
 
-            // then add the number to our current total.
-            c = BigNumber::AbsAdd(c, BigNumber(numbers, 0, false));
+        // remove the leading zeros.
+        while (!quotient.empty() && quotient.back() == 0)
+        {
+            quotient.pop_back();
         }
 
-        // this is the number with no multipliers.
-        return c.PerformPostOperations(precision);
+        // what is left is the remainder, (multiplied by our factor).
+        if (remainder != NULL)
+        {
+            u.resize(n);
+            BigNumber::_DevideLimbs(u, factor);
+            *remainder = std::move(u);
+        }
     }
 
-    unsigned long long BigNumber::_MakeNumberAtIndex(size_t index, size_t length) const
+    /**
+     * Divide 2 big limbs numbers by multiplying the numerator by the reciprocal of the denominator.
+     * The result can be a little bit off, so we correct it with the remainder.
+     * @see _DivModLimbs( ... )
+     * @param const LIMBS& numerator the number been divided.
+     * @param const LIMBS& denominator the number dividing.
+     * @param LIMBS& quotient the quotient of the division.
+     * @param LIMBS* remainder the remainder, (if we want it).
+     */
+    void BigNumber::_DivModLimbsNewton(const LIMBS& numerator, const LIMBS& denominator, LIMBS& quotient, LIMBS* remainder)
     {
-        unsigned long long number = 0;
-        size_t l = _numbers.size();
-        for (long long i = (length - 1); i >= 0; --i)
+        // we need the reciprocal of the denominator with a couple more limbs than the quotient
+        // so we either only use the top of both numbers or we add limbs at the end of both.
+        const size_t m = denominator.size();
+        const size_t used = numerator.size() - m + 3;
+        LIMBS top, part;
+        if (used <= m)
         {
-            unsigned long long pos = (i + index);
-            if (pos >= l)
-            {
-                continue;
-            }
-            number = (number * BIGNUMBER_BASE) + _numbers[(size_t)pos];
+            BigNumber::_SliceLimbs(denominator, m - used, used, top);
+            BigNumber::_SliceLimbs(numerator, m - used, numerator.size(), part);
+        }
+        else
+        {
+            top = denominator;
+            top.insert(top.begin(), used - m, 0);
+            part = numerator;
+            part.insert(part.begin(), used - m, 0);
+        }
+
+        // numerator / denominator = part / top = part * reciprocal / BIGNUMBER_LIMB_BASE^(2*used)
+        LIMBS reciprocal, product;
+        BigNumber::_ReciprocalLimbs(top, reciprocal);
+        BigNumber::_MulLimbs(part, reciprocal, product);
+        BigNumber::_SliceLimbs(product, 2 * used, product.size(), quotient);
+
+        // the remainder = numerator - quotient * denominator
+        // and we correct the quotient if the remainder is not between 0 and the denominator.
+        LIMBS one, rest;
+        one.push_back(1);
+        BigNumber::_MulLimbs(quotient, denominator, product);
+        while (BigNumber::_CompareLimbs(product, numerator) > 0)
+        {
+            BigNumber::_SubLimbsAssign(quotient, one);
+            BigNumber::_SubLimbsAssign(product, denominator);
+        }
+        BigNumber::_SubLimbs(numerator, product, rest);
+        while (BigNumber::_CompareLimbs(rest, denominator) >= 0)
+        {
+            BigNumber::_AddLimbsAssign(quotient, one);
+            BigNumber::_SubLimbsAssign(rest, denominator);
+        }
+
+        if (remainder != NULL)
+        {
+            *remainder = std::move(rest);
         }
-        return number;
     }
 
     /**
-     * Subtract 2 absolute numbers together.
-     * @param const BigNumber& lhs the number been subtracted from
-     * @param const BigNumber& rhs the number been subtracted with.
-     * @return BigNumber the diff of the two numbers.
+     * Calculate the reciprocal of a number, BIGNUMBER_LIMB_BASE^(2*size) / limbs, (give or take a couple).
+     * We work out the reciprocal of the top half of the number and use one Newton iteration
+     * x = x + x * (1 - limbs * x) to double the number of correct limbs.
+     * @see https://en.wikipedia.org/wiki/Division_algorithm#Newton%E2%80%93Raphson_division
+     * @param const LIMBS& limbs the number, (without leading zeros).
+     * @param LIMBS& reciprocal the reciprocal of the number.
      */
-    BigNumber BigNumber::AbsSub(const BigNumber& lhs, const BigNumber& rhs)
+    void BigNumber::_ReciprocalLimbs(const LIMBS& limbs, LIMBS& reciprocal)
     {
-        // compare the 2 numbers
-        if (BigNumber::AbsCompare(lhs, rhs) < 0)
-        {
-            // swap the two values to get a positive result.
-            BigNumber c = BigNumber::AbsSub(rhs, lhs);
+        const size_t size = limbs.size();
 
-            // but we know it is negative
-            c._neg = true;
+        // BIGNUMBER_LIMB_BASE^(2*size)
+        LIMBS power;
+        power.assign(2 * size, 0);
+        power.push_back(1);
 
-            // return the number
-            return c.PerformPostOperations(c._decimals);
+        // small numbers are faster the long way.
+        if (size < BIGNUMBER_NEWTON_LIMBS)
+        {
+            BigNumber::_DivModLimbs(power, limbs, reciprocal, NULL);
+            return;
         }
 
-        // if we want to subtract zero from the lhs, then the result is rhs
-        if (rhs.IsZero())
+        // the reciprocal of the top half, (with a couple more limbs for the error),
+        // shifted so it is close to the reciprocal of the whole number.
+        const size_t half = (size + 1) / 2 + 2;
+        LIMBS top, x;
+        BigNumber::_SliceLimbs(limbs, size - half, half, top);
+        BigNumber::_ReciprocalLimbs(top, x);
+        x.insert(x.begin(), size - half, 0);
+
+        // error = BIGNUMBER_LIMB_BASE^(2*size) - limbs * x
+        LIMBS product, error;
+        BigNumber::_MulLimbs(limbs, x, product);
+        const bool negative = (BigNumber::_CompareLimbs(product, power) > 0);
+        if (negative)
         {
-            return lhs;
+            BigNumber::_SubLimbs(product, power, error);
+        }
+        else
+        {
+            BigNumber::_SubLimbs(power, product, error);
         }
 
-        // we know that lhs is greater than rhs.
-        unsigned char carryOver = 0;
-        size_t ll = lhs._numbers.size();
-        size_t rl = rhs._numbers.size();
+        // x = x + x * error / BIGNUMBER_LIMB_BASE^(2*size)
+        BigNumber::_MulLimbs(x, error, product);
+        LIMBS correction;
+        BigNumber::_SliceLimbs(product, 2 * size, product.size(), correction);
+        if (negative)
+        {
+            BigNumber::_SubLimbs(x, correction, reciprocal);
+        }
+        else
+        {
+            BigNumber::_AddLimbs(x, correction, reciprocal);
+        }
+    }
 
-        // get the maximum number of decimals.
-        int maxDecimals = (int)(lhs._decimals >= rhs._decimals ? lhs._decimals : rhs._decimals);
-        const size_t lhsDecimalsOffset = maxDecimals - lhs._decimals;
-        const size_t rhsDecimalsOffset = maxDecimals - rhs._decimals;
+    /**
+     * Multiply limbs by base, effectively add 'multiplier' zeros at the end.
+     * @param LIMBS& limbs the number we are updating.
+     * @param size_t multiplier the number of times we are multiplying this by.
+     */
+    void BigNumber::_MultiplyLimbsByBase(LIMBS& limbs, size_t multiplier)
+    {
+        if (limbs.empty() || multiplier == 0)
+        {
+            return;
+        }
 
-        NUMBERS numbers;
-        for (size_t i = 0;; ++i)
+        // first the numbers that do not fill a limb.
+        const size_t shift = multiplier % BIGNUMBER_LIMB_DIGITS;
+        if (shift > 0)
         {
-            if ((i - lhsDecimalsOffset) >= ll && (i - rhsDecimalsOffset) >= rl)
+            unsigned long long carryOver = 0;
+            for (size_t i = 0; i < limbs.size(); ++i)
             {
-                break;
+                unsigned long long sum = (unsigned long long)limbs[i] * _limb_powers[shift] + carryOver;
+                limbs[i] = (unsigned int)(sum % BIGNUMBER_LIMB_BASE);
+                carryOver = sum / BIGNUMBER_LIMB_BASE;
             }
-
-            unsigned char l = (i >= lhsDecimalsOffset && i < ll + lhsDecimalsOffset) ? lhs._numbers[i - lhsDecimalsOffset] : 0;
-            unsigned char r = (i >= rhsDecimalsOffset && i < rl + rhsDecimalsOffset) ? rhs._numbers[i - rhsDecimalsOffset] : 0;
-
-            char sum = l - carryOver - r;
-
-            carryOver = 0;
-            if (sum < 0)
+            if (carryOver > 0)
             {
-                sum += BIGNUMBER_BASE;
-                carryOver = 1;
+                limbs.push_back((unsigned int)carryOver);
             }
-
-            numbers.push_back(sum);
         }
 
-        // this is the new numbers
-        return BigNumber(numbers, maxDecimals, false);
+        // then whole limbs of zeros.
+        limbs.insert(limbs.begin(), multiplier / BIGNUMBER_LIMB_DIGITS, 0);
     }
 
     /**
-     * Get a number at a certain position, (from the last digit)
-     * In a number 1234.456 position #0 = 6 and #3=4
-     * The expected decimal, is the number of decimal we should have, if the expected number of decimals is 5, and the
-     * current number is 1234.56 then the 'actual' number is 1234.56000 so we have 5 decimal places.
-     * @param size_t position the number we want.
-     * @param size_t expectedDecimals the number of decimals we _should_ have, (see note).
-     * @return unsigned char the number or 255 if there is no valid number.
-     */
-    unsigned char BigNumber::_At(size_t position, size_t expectedDecimals) const
-    {
-        // the numbers are saved in reverse:
-        //    #123 = [3][2][1]
-        // decimals are the same
-        //    #123.45 = [5][4][3][2][1]
-        //
-        // 'expectedDecimals' are decimals we are expected to have
-        // wether they exist or not, does not matter.
-        // so the number 123 with 2 'expected' decimals becomes
-        //    #123 = [0][0][3][2][1]
-        // but the number 123.45 with 2 'expected' decimals remains
-        //    #123 = [5][4][3][2][1]
-        // 
-        // so, if we are looking to item 'position'=0 and we have 2 'expectedDecimals'
-        // then what we are really after is the first item '0'.
-        //    #123 = [0][0][3][2][1]
-        //
-        int actualPosition = (int)position - (int)expectedDecimals + (int)_decimals;
+     * Devide limbs by base, effectively remove 'divisor' numbers at the end.
+     * 12345 / 100 = 123
+     * @param LIMBS& limbs the number we are updating.
+     * @param size_t divisor the number of times we are dividing this by.
+     */
+    void BigNumber::_DevideLimbsByBase(LIMBS& limbs, size_t divisor)
+    {
+        // remove whole limbs first.
+        const size_t whole = divisor / BIGNUMBER_LIMB_DIGITS;
+        if (whole >= limbs.size())
+        {
+            limbs.clear();
+            return;
+        }
+        limbs.erase(limbs.begin(), limbs.begin() + whole);
 
-        // if that number is negative or past our limit
-        // then we return 255
-        if (actualPosition < 0 || actualPosition >= (int)_numbers.size())
+        // then the numbers that do not fill a limb.
+        const size_t shift = divisor % BIGNUMBER_LIMB_DIGITS;
+        if (shift > 0)
         {
-            return (unsigned char)255;
+            const unsigned int power = _limb_powers[shift];
+            const unsigned int multiplier = _limb_powers[BIGNUMBER_LIMB_DIGITS - shift];
+            for (size_t i = 0; i < limbs.size(); ++i)
+            {
+                unsigned int number = limbs[i] / power;
+                if (i + 1 < limbs.size())
+                {
+                    number += (limbs[i + 1] % power) * multiplier;
+                }
+                limbs[i] = number;
+            }
         }
 
-        // we all good!
-        return _numbers[actualPosition];
+        // remove the leading zeros.
+        while (!limbs.empty() && limbs.back() == 0)
+        {
+            limbs.pop_back();
+        }
     }
 
     /**
-     * Add 2 absolute numbers together.
-     * @param const BigNumber& lhs the number been Added from
-     * @param const BigNumber& rhs the number been Added with.
-     * @return BigNumber the sum of the two numbers.
+     * Only keep the last 'divisor' numbers of the limbs, (the remainder of limbs / base^divisor).
+     * 12345 % 100 = 45
+     * @param LIMBS& limbs the number we are updating.
+     * @param size_t divisor the number of numbers we want to keep.
      */
-    BigNumber BigNumber::AbsAdd(const BigNumber& lhs, const BigNumber& rhs)
+    void BigNumber::_ModuloLimbsByBase(LIMBS& limbs, size_t divisor)
     {
-        // the carry over
-        unsigned char carryOver = 0;
+        const size_t whole = divisor / BIGNUMBER_LIMB_DIGITS;
+        const size_t shift = divisor % BIGNUMBER_LIMB_DIGITS;
+        if (whole + (shift > 0 ? 1 : 0) < limbs.size())
+        {
+            limbs.resize(whole + (shift > 0 ? 1 : 0));
+        }
+        if (shift > 0 && whole < limbs.size())
+        {
+            limbs[whole] %= _limb_powers[shift];
+        }
 
-        // get the maximum number of decimals.
-        int maxDecimals = (int)(lhs._decimals >= rhs._decimals ? lhs._decimals : rhs._decimals);
+        // remove the leading zeros.
+        while (!limbs.empty() && limbs.back() == 0)
+        {
+            limbs.pop_back();
+        }
+    }
 
-        NUMBERS numbers;
-        for (size_t i = 0;; ++i)
+    /**
+     * Count the number of zeros at the end of a number, 12300 has 2 zeros.
+     * @param const LIMBS& limbs the number we are checking, it cannot be zero.
+     * @param size_t max we do not need to count past that number.
+     * @return size_t the number of zeros.
+     */
+    size_t BigNumber::_TrailingZeros(const LIMBS& limbs, size_t max)
+    {
+        size_t zeros = 0;
+        for (size_t i = 0; i < limbs.size() && zeros < max; ++i)
         {
-            unsigned char l = lhs._At(i, maxDecimals);
-            unsigned char r = rhs._At(i, maxDecimals);
-            if (l == 255 && r == 255) {
-                break;
+            if (limbs[i] == 0)
+            {
+                zeros += BIGNUMBER_LIMB_DIGITS;
+                continue;
             }
-
-            l = (l == 255) ? 0 : l;
-            r = (r == 255) ? 0 : r;
-
-            unsigned char sum = l + r + carryOver;
-
-            carryOver = 0;
-            if (sum >= BIGNUMBER_BASE)
+            for (unsigned int limb = limbs[i]; limb % BIGNUMBER_BASE == 0; limb /= BIGNUMBER_BASE)
             {
-                sum -= BIGNUMBER_BASE;
-                carryOver = 1;
+                ++zeros;
             }
-            numbers.push_back(sum);
-        }
-
-        if (carryOver > 0)
-        {
-            numbers.push_back(1);
+            break;
         }
-
-        // this is the new numbers
-        return BigNumber(numbers, maxDecimals, false);
+        return zeros < max ? zeros : max;
     }
 
     /**
-     * Compare two number ignoring the sign.
-     * @param const BigNumber& lhs the left hand side number
-     * @param const BigNumber& rhs the right hand size number
-     * @return int -ve rhs is greater, +ve lhs is greater and 0 = they are equal.
+     * Get the limbs as a single 64 bit number, if they fit.
+     * @param const LIMBS& limbs the number we want to convert.
+     * @param unsigned long long& number the converted number.
+     * @return bool if the number fits in 2 limbs or not.
      */
-    int BigNumber::AbsCompare(const BigNumber& lhs, const BigNumber& rhs)
+    bool BigNumber::_LimbsToULongLong(const LIMBS& limbs, unsigned long long& number)
     {
-        size_t ll = lhs._numbers.size();
-        size_t rl = rhs._numbers.size();
+        switch (limbs.size())
+        {
+        case 0:
+            number = 0;
+            return true;
+
+        case 1:
+            number = limbs[0];
+            return true;
 
-        int maxDecimals = (int)(lhs._decimals >= rhs._decimals ? lhs._decimals : rhs._decimals);
-        int lhsDecimalsOffset = maxDecimals - (int)lhs._decimals;
-        int rhsDecimalsOffset = maxDecimals - (int)rhs._decimals;
+        case 2:
+            number = limbs[0] + (unsigned long long)limbs[1] * BIGNUMBER_LIMB_BASE;
+            return true;
 
-        if (ll + lhsDecimalsOffset > rl + rhsDecimalsOffset) {
-            return 1;
+        default:
+            return false;
         }
-        if (ll + lhsDecimalsOffset < rl + rhsDecimalsOffset) {
-            return -1;
+    }
+
+    /**
+     * Set the limbs from a single 64 bit number.
+     * @param unsigned long long number the number we are converting.
+     * @param LIMBS& limbs the limbs we are updating.
+     */
+    void BigNumber::_ULongLongToLimbs(unsigned long long number, LIMBS& limbs)
+    {
+        limbs.clear();
+        while (number > 0)
+        {
+            limbs.push_back((unsigned int)(number % BIGNUMBER_LIMB_BASE));
+            number /= BIGNUMBER_LIMB_BASE;
         }
+    }
 
-        if (ll == 0) {
-            return 0; //  they both zero len
+    /**
+     * The number of numbers in limbs, without the leading zeros, zero has no numbers.
+     * @param const LIMBS& limbs the number.
+     * @return size_t the number of numbers.
+     */
+    size_t BigNumber::_LimbsDigits(const LIMBS& limbs)
+    {
+        if (limbs.empty())
+        {
+            return 0;
+        }
+        size_t digits = (limbs.size() - 1) * BIGNUMBER_LIMB_DIGITS;
+        for (unsigned int top = limbs.back(); top > 0; top /= BIGNUMBER_BASE)
+        {
+            ++digits;
         }
+        return digits;
+    }
 
-        // compare the whole numbers first.
-        // because we know these are the same len, (they have to be).
-        // otherwise the numbers above would not have worked.
-        for (int i = (int)(ll - lhs._decimals - 1); i >= 0; --i)
+    /**
+     * Write the lowest numbers of limbs as characters, the units are written last, just before 'end'.
+     * If we want more numbers than the limbs have, the rest are zeros.
+     * @param const LIMBS& limbs the number.
+     * @param size_t count the number of numbers we want.
+     * @param char* end the character after the last one we will write.
+     */
+    void BigNumber::_WriteLimbs(const LIMBS& limbs, size_t count, char* end)
+    {
+        for (size_t i = 0; count > 0; ++i)
         {
-            // get the numbers past the multiplier.
-            unsigned char ucl = lhs._numbers[i + lhs._decimals];
-            unsigned char ucr = rhs._numbers[i + rhs._decimals];
-            if (ucl == ucr) //  still the same number
+            unsigned int limb = i < limbs.size() ? limbs[i] : 0;
+            for (size_t j = 0; j < BIGNUMBER_LIMB_DIGITS && count > 0; ++j, --count)
             {
-                continue;
+                *--end = (char)('0' + limb % BIGNUMBER_BASE);
+                limb /= BIGNUMBER_BASE;
             }
+        }
+    }
 
-            //  123 > 113
-            if (ucl > ucr)
+    /**
+     * Convert the limbs to one number per item, the way ToBase( ... ) expects them.
+     * There is always at least one number before the decimal, 0.05 = [5][0][0]
+     * @param NUMBERS& numbers the numbers, in reverse.
+     */
+    void BigNumber::_ToNumbers(NUMBERS& numbers) const
+    {
+        numbers.clear();
+        numbers.reserve(_limbs.size() * BIGNUMBER_LIMB_DIGITS + 1);
+        for (size_t i = 0; i < _limbs.size(); ++i)
+        {
+            unsigned int limb = _limbs[i];
+            for (size_t j = 0; j < BIGNUMBER_LIMB_DIGITS; ++j)
             {
-                return 1;
+                numbers.push_back((unsigned char)(limb % BIGNUMBER_BASE));
+                limb /= BIGNUMBER_BASE;
             }
+        }
+
+        // remove the 'leading' zeros of the last limb
+        while (!numbers.empty() && numbers.back() == 0)
+        {
+            numbers.pop_back();
+        }
+
+        // but we need the zero in front of the decimals.
+        while (numbers.size() < _decimals + 1)
+        {
+            numbers.push_back(0);
+        }
+    }
 
-            //  123 < 133
-            if (ucl < ucr)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    /**
+     * The number of characters, from the start, that are all numbers, 16 at a time.
+     * @param const char* source the characters.
+     * @param size_t length the number of characters we can read.
+     * @return size_t the number of characters that are numbers.
+     */
+    __attribute__((target("sse2")))
+    static size_t _DigitsRunSse2(const char* source, size_t length)
+    {
+        const __m128i zero = _mm_set1_epi8('0');
+        const __m128i nine = _mm_set1_epi8(9);
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16)
+        {
+            // c - '0' is 0 to 9 for the numbers, (as an unsigned char).
+            const __m128i numbers = _mm_sub_epi8(_mm_loadu_si128((const __m128i*)(source + i)), zero);
+            const unsigned int mask = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(numbers, nine), numbers));
+            if (mask != 0xFFFF)
             {
-                return -1;
+                return i + __builtin_ctz(~mask);
             }
         }
+        return i;
+    }
+#endif
 
-        // ok so the two whole numbers are the same
-        // something like 20.123 and 20.122
-        // we now know that 20=20
-        // but we must now compare the decimal points.
-        // unlike the above when we go in reverse, in the case we must go forward 122 < 123.
-        // the number of decimals might also not match.
-        for (int i = maxDecimals - 1; i >= 0; --i)
+    /**
+     * The number of characters, from the start, that are all numbers.
+     * Long runs are checked 16 at a time with SSE2, or 8 at a time in a 64 bit number.
+     * @param const char* source the characters.
+     * @param size_t length the number of characters we can read.
+     * @return size_t the number of characters that are numbers.
+     */
+    size_t BigNumber::_DigitsRun(const char* source, size_t length)
+    {
+        size_t i = 0;
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+        if (length >= 16 && _SimdLevel() >= 1)
+        {
+            i = _DigitsRunSse2(source, length);
+        }
+#endif
+#if BIGNUMBER_LITTLE_ENDIAN
+        for (; i + 8 <= length; i += 8)
         {
-            unsigned char ucl = (i - lhsDecimalsOffset < 0) ? 0 : lhs._numbers[i - lhsDecimalsOffset];
-            unsigned char ucr = (i - rhsDecimalsOffset < 0) ? 0 : rhs._numbers[i - rhsDecimalsOffset];
-            if (ucl == ucr) //  still the same number
+            // a byte has its top bit set if it was below '0', (c - '0'), or above '9', (c + 0x46).
+            // a borrow or a carry only changes the bytes after the first one that is not a number.
+            unsigned long long block;
+            std::memcpy(&block, source + i, 8);
+            const unsigned long long outside = ((block + 0x4646464646464646ULL) | (block - 0x3030303030303030ULL)) & 0x8080808080808080ULL;
+            if (outside != 0)
             {
-                continue;
+                for (; source[i] >= '0' && source[i] <= '9'; ++i);
+                return i;
             }
+        }
+#endif
+        for (; i < length && source[i] >= '0' && source[i] <= '9'; ++i);
+        return i;
+    }
 
-            //  .123 > .113
-            if (ucl > ucr)
+    /**
+     * Pack the numbers, as characters, the biggest first, in limbs.
+     * Full limbs are the first number * 10^8 plus the next 8 numbers, converted in one 64 bit number.
+     * @see http://govnokod.ru/13461 and https://github.com/fastfloat/fast_float
+     * @param const char* digits the numbers, '0' to '9', the biggest first.
+     * @param size_t count the number of numbers.
+     * @param LIMBS& limbs the packed numbers.
+     */
+    void BigNumber::_DigitsToLimbs(const char* digits, size_t count, LIMBS& limbs)
+    {
+        limbs.resize((count + BIGNUMBER_LIMB_DIGITS - 1) / BIGNUMBER_LIMB_DIGITS);
+        size_t limb = 0;
+        for (size_t end = count; end > 0; end = (end > BIGNUMBER_LIMB_DIGITS ? end - BIGNUMBER_LIMB_DIGITS : 0), ++limb)
+        {
+            const char* first = digits + (end > BIGNUMBER_LIMB_DIGITS ? end - BIGNUMBER_LIMB_DIGITS : 0);
+            const char* last = digits + end;
+#if BIGNUMBER_LITTLE_ENDIAN
+            if (last - first == BIGNUMBER_LIMB_DIGITS)
             {
-                return 1;
+                // each step adds pairs of numbers, 8 x 1 > 4 x 2 > 2 x 4 > 1 x 8
+                unsigned long long block;
+                std::memcpy(&block, first + 1, 8);
+                block -= 0x3030303030303030ULL;
+                block = (block * 10) + (block >> 8);
+                block = (((block & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) + (((block >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+                limbs[limb] = (unsigned int)(first[0] - '0') * 100000000 + (unsigned int)block;
+                continue;
             }
-
-            //  .123 < .133
-            if (ucl < ucr)
+#endif
+            unsigned int value = 0;
+            for (; first < last; ++first)
             {
-                return -1;
+                value = value * 10 + (unsigned int)(*first - '0');
             }
+            limbs[limb] = value;
         }
+    }
 
-        // they are the same
-        return 0;
+    /**
+     * Pack numbers, one per item, into limbs
+     * @param const NUMBERS& numbers the numbers, in reverse, [3][2][1] = 123
+     * @param LIMBS& limbs the packed numbers.
+     */
+    void BigNumber::_NumbersToLimbs(const NUMBERS& numbers, LIMBS& limbs)
+    {
+        limbs.assign((numbers.size() + BIGNUMBER_LIMB_DIGITS - 1) / BIGNUMBER_LIMB_DIGITS, 0);
+        for (size_t i = 0; i < numbers.size(); ++i)
+        {
+            limbs[i / BIGNUMBER_LIMB_DIGITS] += numbers[i] * _limb_powers[i % BIGNUMBER_LIMB_DIGITS];
+        }
     }
 
     /**
@@ -1110,7 +2794,7 @@ namespace MyOddWeb
         }
 
         // get the first non decimal number.
-        const char& c = *(_numbers.begin() + _decimals);
+        const unsigned char c = _At(_decimals);
 
         // is that number even?
         return ((c % 2) == 0);
@@ -1296,12 +2980,8 @@ namespace MyOddWeb
             //  both +1 or both -1
             // -1 + -1 = -1 * (1+1)
             // 1 + 1 = 1 * (1+1)
-            *this = BigNumber::AbsAdd(rhs, *this);
-
-            // the sign of *this will be lost and become
-            // positive, (this is what the function does).
-            // but we can use the one from rhs as that was not changed.
-            _neg = rhs._neg;
+            // our sign is not changed, so it is the sign of both numbers.
+            AbsAddAssign(rhs);
 
             // return this/cleaned up.
             return PerformPostOperations(_decimals);
@@ -1317,7 +2997,7 @@ namespace MyOddWeb
 
             //  10 + -5 = this._neg * (10 - 5)  = 5
             //  -10 + 5 = this._neg * (10 - 5)  = -5
-            *this = BigNumber::AbsSub(*this, rhs);
+            AbsSubAssign(rhs);
 
             // set the sign
             _neg = neg;
@@ -1331,7 +3011,7 @@ namespace MyOddWeb
 
         //  5 + -10 = this._neg * (10 - 5)  = -5
         //  -5 + 10 = this._neg * (10 - 5)  = 5
-        *this = BigNumber::AbsSub(rhs, *this);
+        AbsSubAssign(rhs);
 
         // set the sign
         _neg = neg;
@@ -1356,7 +3036,7 @@ namespace MyOddWeb
 
             //  5 - -10 = this._neg * (10 + 5)  = 15
             //  -5 - 10 = this._neg * (10 + 5)  = -15
-            *this = BigNumber::AbsAdd(rhs, *this);
+            AbsAddAssign(rhs);
 
             // set the sign
             _neg = neg;
@@ -1375,7 +3055,7 @@ namespace MyOddWeb
 
             //  -10 - -5 = this._neg * (10 - 5)  = -5
             //  10 - 5 = this._neg * (10 - 5)  = 5
-            *this = BigNumber::AbsSub(*this, rhs);
+            AbsSubAssign(rhs);
 
             // set the sign
             _neg = neg;
@@ -1392,7 +3072,7 @@ namespace MyOddWeb
 
         //  -5 - -10 = !rhs._neg * (10 - 5)  = 5
         //  5 - 10 = !rhs._neg * (10 - 5)  = -5
-        *this = BigNumber::AbsSub(rhs, *this);
+        AbsSubAssign(rhs);
 
         // set the oposite sign
         _neg = !neg;
@@ -1598,7 +3278,7 @@ namespace MyOddWeb
         bool neg = (rhs.IsNeg() != IsNeg());
 
         // just multiply
-        *this = BigNumber::AbsMul(*this, rhs, precision);
+        AbsMulAssign(rhs, precision);
 
         // set the sign.
         _neg = neg;
@@ -1623,6 +3303,24 @@ namespace MyOddWeb
         return quotient;
     }
 
+    /**
+     * Calculate both the quotient and the remainder when 2 numbers are divided.
+     * This is the same as calling Quotient( ... ) and Mod( ... ) but we only divide once.
+     * Small denominators, (that fit in 9 numbers), are done in a single pass.
+     * @param const BigNumber& denominator the denominator dividing this number
+     * @param BigNumber& quotient the quotient of the division.
+     * @param BigNumber& remainder the remainder of the division.
+     */
+    void BigNumber::DivMod(const BigNumber& denominator, BigNumber& quotient, BigNumber& remainder) const
+    {
+        // we might be asked to put the results in ourselves.
+        BigNumber q;
+        BigNumber r;
+        BigNumber::QuotientAndRemainder(*this, denominator, q, r);
+        quotient = q;
+        remainder = r;
+    }
+
     /**
      * Calculate the remainder when 2 numbers are divided.
      * @param const BigNumber& denominator the denominator dividing this number
@@ -1646,6 +3344,123 @@ namespace MyOddWeb
         return remainder;
     }
 
+    /**
+     * Multiply this number and add another one in a single step, this = this * multiplier + addend
+     * If the multiplier is a whole number that fits in a limb, (10, 1000, ...), and the product
+     * and the addend have the same sign, both are done in one pass over the limbs,
+     * otherwise it is the same as Mul( multiplier, precision ).Add( addend )
+     * @param const BigNumber& multiplier the number we are multiplying by.
+     * @param const BigNumber& addend the number we are adding to the product.
+     * @param size_t precision the precision of the multiplication.
+     * @return BigNumber& this number.
+     */
+    BigNumber& BigNumber::MulAdd(const BigNumber& multiplier, const BigNumber& addend, size_t precision)
+    {
+        // the sign of the product, and if we can add the addend without subtracting.
+        const bool neg = (multiplier.IsNeg() != IsNeg());
+        const bool fused = !IsNan() && !multiplier.IsNan() && !addend.IsNan()
+                        && multiplier._decimals == 0 && multiplier._limbs.size() <= 1
+                        && _decimals <= precision
+                        && (addend.IsZero() || IsZero() || multiplier.IsZero() || addend.IsNeg() == neg);
+        if (!fused)
+        {
+            if (&addend == this)
+            {
+                // the product would replace the number we want to add.
+                const BigNumber copy(addend);
+                return Mul(multiplier, precision).Add(copy);
+            }
+            return Mul(multiplier, precision).Add(addend);
+        }
+
+        // the addend can be this number, (x * 10 + x), so we take its limbs before we change ours.
+        const unsigned int number = multiplier.IsZero() ? 0 : multiplier._limbs[0];
+        const bool productIsZero = IsZero() || multiplier.IsZero();
+        const size_t decimals = _decimals >= addend._decimals ? _decimals : addend._decimals;
+        LIMBS buffer;
+        if (&addend == this)
+        {
+            buffer = _limbs;
+            BigNumber::_MultiplyLimbsByBase(buffer, decimals - _decimals);
+        }
+        const LIMBS& addendLimbs = (&addend == this) ? buffer : addend._AlignedLimbs(decimals, buffer);
+
+        BigNumber::_MultiplyLimbsByBase(_limbs, decimals - _decimals);
+        BigNumber::_MulAddLimbs(_limbs, number, addendLimbs);
+        _decimals = decimals;
+        _neg = productIsZero ? addend.IsNeg() : neg;
+
+        // clean it all up.
+        return PerformPostOperations(_decimals);
+    }
+
+    /**
+     * Divide this number by a divisor and keep the whole part, the remainder is returned as well.
+     * This is the same as remainder = Mod( divisor ) and Div( divisor ).Integer()
+     * but we only divide once, and a divisor that fits in a limb is done in place.
+     * 17 / 5 = 3 remainder 2, -17 / 5 = -3 remainder -2
+     * @param const BigNumber& divisor the number dividing this number.
+     * @param BigNumber& remainder the remainder of the division, (it cannot be this number).
+     * @return BigNumber& this number, the whole part of the division.
+     */
+    BigNumber& BigNumber::DivModInteger(const BigNumber& divisor, BigNumber& remainder)
+    {
+        const bool neg = IsNeg();
+        const bool divisorNeg = divisor.IsNeg();
+        if (!IsNan() && _decimals == 0 && divisor._decimals == 0 && divisor._limbs.size() == 1)
+        {
+            // short division of our own limbs.
+            const unsigned int rest = BigNumber::_DevideLimbs(_limbs, divisor._limbs[0]);
+            _neg = (neg != divisorNeg);
+            PerformPostOperations(0);
+
+            remainder.Default();
+            BigNumber::_ULongLongToLimbs(rest, remainder._limbs);
+            remainder._neg = neg;
+            remainder.PerformPostOperations(0);
+            return *this;
+        }
+
+        // otherwise use the full division.
+        BigNumber q;
+        BigNumber r;
+        BigNumber::AbsQuotientAndRemainder(*this, divisor, q, r);
+        if (!q.IsNan())
+        {
+            q._neg = (neg != divisorNeg);
+            r._neg = neg;
+            q.PerformPostOperations(0);
+            r.PerformPostOperations(r._decimals);
+        }
+        remainder = std::move(r);
+        *this = std::move(q);
+        return *this;
+    }
+
+    /**
+     * Move the decimal point, this = this * 10^digits
+     * ShiftDigits(2) of 12.345 = 1234.5 and ShiftDigits(-2) of 12.345 = 0.12345
+     * Only the limbs or the number of decimals are moved, nothing is multiplied.
+     * @param int digits the number of places we are moving the point to the right, (negative to the left).
+     * @return BigNumber& this number.
+     */
+    BigNumber& BigNumber::ShiftDigits(int digits)
+    {
+        if (IsNan() || IsZero() || digits == 0)
+        {
+            return *this;
+        }
+        if (digits > 0)
+        {
+            MultiplyByBase((size_t)digits);
+        }
+        else
+        {
+            DevideByBase((size_t)(-(long long)digits));
+        }
+        return *this;
+    }
+
     /**
      * Calculate the factorial of a non negative number
      * 5! = 5x4x3x2x1 = 120
@@ -1674,6 +3489,15 @@ namespace MyOddWeb
             return *this;
         }
 
+        // for whole numbers we multiply 1x2x3...xn as a product tree
+        // so we are always multiplying numbers of about the same size.
+        unsigned long long number;
+        if (IsInteger() && BigNumber::_LimbsToULongLong(_limbs, number))
+        {
+            *this = BigNumber::ProductRange(1, number);
+            return *this;
+        }
+
         // the factorial.
         BigNumber c = *this;
 
@@ -1693,6 +3517,77 @@ namespace MyOddWeb
         return *this;
     }
 
+    /**
+     * Calculate the product of all the whole numbers between first and last, first x (first+1) x ... x last
+     * ProductRange(4, 6) = 4x5x6 = 120 and ProductRange(1, n) = n!
+     * @param unsigned long long first the first number we multiply.
+     * @param unsigned long long last the last number we multiply.
+     * @return BigNumber the product, one if first is greater than last.
+     */
+    BigNumber BigNumber::ProductRange(unsigned long long first, unsigned long long last)
+    {
+        if (first > last)
+        {
+            // the empty product.
+            return _number_one;
+        }
+        if (first == 0)
+        {
+            // zero x anything = zero.
+            return _number_zero;
+        }
+
+        BigNumber c;
+        BigNumber::_ProductRangeLimbs(first, last, c._limbs);
+        return c.PerformPostOperations(0);
+    }
+
+    /**
+     * Multiply all the whole numbers between first and last, (first <= last).
+     * We split the range in 2 halves and multiply the product of each half
+     * so the numbers we multiply are about the same size, and the faster multiplications can be used.
+     * @see https://en.wikipedia.org/wiki/Factorial#Computation
+     * @param unsigned long long first the first number we multiply.
+     * @param unsigned long long last the last number we multiply.
+     * @param LIMBS& product the product of all the numbers.
+     */
+    void BigNumber::_ProductRangeLimbs(unsigned long long first, unsigned long long last, LIMBS& product)
+    {
+        // small ranges are multiplied in 64 bits for as long as we can.
+        if (last - first < 32)
+        {
+            LIMBS number, result;
+            BigNumber::_ULongLongToLimbs(1, product);
+            unsigned long long partial = 1;
+            for (unsigned long long i = first;; ++i)
+            {
+                if (partial > std::numeric_limits<unsigned long long>::max() / i)
+                {
+                    BigNumber::_ULongLongToLimbs(partial, number);
+                    BigNumber::_MulLimbs(product, number, result);
+                    product = std::move(result);
+                    partial = 1;
+                }
+                partial *= i;
+                if (i == last)
+                {
+                    break;
+                }
+            }
+            BigNumber::_ULongLongToLimbs(partial, number);
+            BigNumber::_MulLimbs(product, number, result);
+            product = std::move(result);
+            return;
+        }
+
+        // (first x ... x middle) x (middle+1 x ... x last)
+        const unsigned long long middle = first + (last - first) / 2;
+        LIMBS lower, upper;
+        BigNumber::_ProductRangeLimbs(first, middle, lower);
+        BigNumber::_ProductRangeLimbs(middle + 1, last, upper);
+        BigNumber::_MulLimbs(lower, upper, product);
+    }
+
     /**
      * Calculate the quotien and remainder of a division
      * @see https://en.wikipedia.org/wiki/Modulo_operation
@@ -1756,115 +3651,31 @@ namespace MyOddWeb
             return;
         }
 
-        // do a 'quick' remainder calculatation.
-        //
-        // 1- look for the 'max' denominator.
-        //    we need the number to be positive.
-        BigNumber max_denominator = denominator;
-        max_denominator._neg = false;
-        BigNumber base_multiplier = _number_one;
-
-        while (BigNumber::AbsCompare(max_denominator, numerator) < 0)
-        {
-            max_denominator.MultiplyByBase(1);
-            base_multiplier.MultiplyByBase(1);
-        }
-
-        // 2- subtract, (if need be, then update the quotient accordingly).
-        for (;;)
-        {
-            // make sure that the max denominator and multiplier
-            // are still within the limits we need.
-            if (!BigNumber::_RecalcDenominator(max_denominator, base_multiplier, remainder))
-            {
-                break;
-            }
-
-            // we can still remove this amount from the loop.
-            remainder.Sub(max_denominator);
-
-            // and add the quotien.
-            quotient.Add(base_multiplier);
-        }
-
-        for (;;)
+        // if both numbers fit in 64 bits, (once they have the same decimals), we can just divide them.
+        // 12.5 % 0.3 = 125 % 30 = 5 = 0.5 and 125 / 30 = 4
+        const size_t maxDecimals = (numerator._decimals >= denominator._decimals ? numerator._decimals : denominator._decimals);
+        LIMBS numeratorBuffer, denominatorBuffer;
+        const LIMBS& numeratorLimbs = numerator._AlignedLimbs(maxDecimals, numeratorBuffer);
+        const LIMBS& denominatorLimbs = denominator._AlignedLimbs(maxDecimals, denominatorBuffer);
+        unsigned long long n, d;
+        if (BigNumber::_LimbsToULongLong(numeratorLimbs, n) && BigNumber::_LimbsToULongLong(denominatorLimbs, d))
         {
-            BigNumber f = BigNumber::AbsSub(remainder, denominator);
-            if (f.IsNeg())
-            {
-                //  that's it, removing that number would
-                // cause the number to be negative.
-                // so we cannot remove anymore.
-                break;
-            }
-
-            // we added it one more time
-            quotient.Add(1);
-
-            // set the new value of the remainder.
-            remainder = f;
-        }
+            BigNumber::_ULongLongToLimbs(n / d, quotient._limbs);
+            quotient.PerformPostOperations(0);
 
-        // clean up the quotient and the remainder.
-        remainder.PerformPostOperations(remainder._decimals);
-        quotient.PerformPostOperations(quotient._decimals);
-    }
-
-    /**
-     * Work out the bigest denominator we can use for the given remainder
-     * This is not a stand alone function, the values are calculated based on the value given to us.
-     * @param BigNumber& max_denominator the current denominator, if it is too big we will devide it by base
-     * @param BigNumber& base_multiplier the current multiplier, it the denominator is too big, we will divide it as well.
-     * @param const BigNumber& remainder the current remainder value.
-     * @return bool if we can continue using the values or if we must end now.
-     */
-    bool BigNumber::_RecalcDenominator(BigNumber& max_denominator, BigNumber& base_multiplier, const BigNumber& remainder)
-    {
-        // are done with this?
-        if (remainder.IsZero())
-        {
-            return false;
+            BigNumber::_ULongLongToLimbs(n % d, remainder._limbs);
+            remainder._decimals = maxDecimals;
+            remainder.PerformPostOperations(maxDecimals);
+            return;
         }
 
-        // if the max denominator is greater than the remained
-        // then we must devide by BIGNUMBER_BASE.
-        int compare = BigNumber::AbsCompare(max_denominator, remainder);
-        switch (compare)
-        {
-        case 0:
-            //  it is the same!
-            // the remainder has to be zero
-            return true;
-
-            // we cannot subtract the max_denominator as it is greater than the remainder.
-            // so we divide it so we can look for a smaller number.
-        case 1:
-            // divide all by BIGNUMBER_BASE
-            max_denominator.DevideByBase(1);
-            base_multiplier.DevideByBase(1);
-
-            // have we reached the end of the division limits?
-            if (!base_multiplier.IsInteger())
-            {
-                // the number is no longer an integer
-                // meaning that we have divided it to the maximum.
-                return false;
-            }
-
-            // compare the value again, if it is _still_ too big, then go around divide it again.
-            // this causes recursion, but it should never hit any limits.
-            int compare = BigNumber::AbsCompare(max_denominator, remainder);
-            if (compare != -1)
-            {
-                return BigNumber::_RecalcDenominator(max_denominator, base_multiplier, remainder);
-            }
-
-            // the number is now small enough and can be used.
-            return true;
-        }
+        // both numbers have the same number of decimals, so we can divide the limbs as they are
+        // and the remainder has that same number of decimals.
+        BigNumber::_DivModLimbs(numeratorLimbs, denominatorLimbs, quotient._limbs, &remainder._limbs);
+        quotient.PerformPostOperations(0);
 
-        //  still big enough.
-        return true;
+        remainder._decimals = maxDecimals;
+        remainder.PerformPostOperations(maxDecimals);
     }
 
     /**
@@ -1992,27 +3803,19 @@ namespace MyOddWeb
             return 0;
         }
 
-        // the return number.
-        int number = 0;
+        // all we are after is the integer.
+        LIMBS limbs = _limbs;
+        BigNumber::_DevideLimbsByBase(limbs, _decimals);
 
-        // the total number of items.
-        size_t l = _numbers.size();
+        // the return number, if it is too big it will overflow like an int would.
+        unsigned int number = 0;
 
-        // go around each number and re-create the integer.
-        for (NUMBERS::const_reverse_iterator rit = _numbers.rbegin(); rit != _numbers.rend(); ++rit)
+        // go around each limb and re-create the integer.
+        for (size_t i = limbs.size(); i > 0; --i)
         {
-            const unsigned char c = *rit;
-            number = number * BIGNUMBER_BASE + c;
-
-            // have we reached the decimal point?
-            // if we have then we must stop now as all
-            // we are after is the integer.
-            if (--l - _decimals == 0)
-            {
-                break;
-            }
+            number = number * BIGNUMBER_LIMB_BASE + limbs[i - 1];
         }
-        return IsNeg() ? -1 * number : number;
+        return IsNeg() ? -1 * (int)number : (int)number;
     }
 
     /**
@@ -2024,7 +3827,86 @@ namespace MyOddWeb
      */
     std::string BigNumber::ToString() const
     {
-        return ToBase(BIGNUMBER_BASE, _decimals);
+        std::string number(ToStringLength(), '0');
+        AppendTo(&number[0]);
+        return number;
+    }
+
+    /**
+     * The number of characters ToString() would give us, (without the '\0').
+     * @return size_t the length of the number as a string.
+     */
+    size_t BigNumber::ToStringLength() const
+    {
+        if (IsNan())
+        {
+            return 3;
+        }
+
+        // there is always at least one number before the decimal point, 0.05
+        size_t digits = BigNumber::_LimbsDigits(_limbs);
+        if (digits < _decimals + 1)
+        {
+            digits = _decimals + 1;
+        }
+        return (IsNeg() ? 1 : 0) + digits + (_decimals > 0 ? 1 : 0);
+    }
+
+    /**
+     * Write the number, the same as ToString(), in a buffer we do not own, nothing is allocated.
+     * The buffer must have room for ToStringLength() characters, no '\0' is added.
+     *   char* end = number.AppendTo( buffer );
+     * @param char* buffer where we are writing the number.
+     * @return char* the character after the last one we wrote.
+     */
+    char* BigNumber::AppendTo(char* buffer) const
+    {
+        if (IsNan())
+        {
+            std::memcpy(buffer, "NaN", 3);
+            return buffer + 3;
+        }
+
+        char* end = buffer + ToStringLength();
+        if (IsNeg())
+        {
+            *buffer++ = '-';
+        }
+
+        // write all the numbers, from the units up, then move the whole numbers
+        // one to the left to make room for the decimal point.
+        const size_t digits = (end - buffer) - (_decimals > 0 ? 1 : 0);
+        BigNumber::_WriteLimbs(_limbs, digits, end);
+        if (_decimals > 0)
+        {
+            const size_t whole = digits - _decimals;
+            std::memmove(buffer, buffer + 1, whole);
+            buffer[whole] = '.';
+        }
+        return end;
+    }
+
+    /**
+     * Write the number, the same as ToString(), in a buffer of a given size, with a '\0' at the end.
+     * If the buffer is too small, nothing is written, (other than a '\0' if there is room for it).
+     * @param char* buffer where we are writing the number.
+     * @param size_t size the number of characters we can write, including the '\0'.
+     * @return size_t the length of the number, (without the '\0'), even if it was not written.
+     */
+    size_t BigNumber::WriteDigits(char* buffer, size_t size) const
+    {
+        const size_t length = ToStringLength();
+        if (buffer == NULL || size == 0)
+        {
+            return length;
+        }
+        if (size <= length)
+        {
+            *buffer = '\0';
+            return length;
+        }
+        *AppendTo(buffer) = '\0';
+        return length;
     }
 
     /**
@@ -2054,7 +3936,9 @@ namespace MyOddWeb
         // is it the correct base already?
         if (BIGNUMBER_BASE == base)
         {
-            return BigNumber::_ToString(_numbers, _decimals, IsNeg(), precision);
+            NUMBERS numbers;
+            _ToNumbers(numbers);
+            return BigNumber::_ToString(numbers, _decimals, IsNeg(), precision);
         }
 
         // the base is not the same, so we now have to rebuild it.
@@ -2086,34 +3970,24 @@ namespace MyOddWeb
     void BigNumber::_ConvertIntegerToBase(const BigNumber& givenNumber, NUMBERS& numbers, const unsigned short base)
     {
         numbers.clear();
-        BigNumber resultInteger = BigNumber(givenNumber).Integer();
-        if (resultInteger.IsZero())
+
+        // only the integer part of the number.
+        LIMBS integer(givenNumber._limbs);
+        BigNumber::_DevideLimbsByBase(integer, givenNumber._decimals);
+        if (integer.empty())
         {
             // the integer part must have at least one number, 'zero' itself.
             numbers.push_back(0);
             return;
         }
 
-        BigNumber bigNumberBase = base;
-
-        for (;;)
-        {
-            BigNumber quotient;
-            BigNumber remainder;
-            BigNumber::AbsQuotientAndRemainder(resultInteger, bigNumberBase, quotient, remainder);
-            numbers.push_back((char)remainder.ToInt());
-
-            // are we done?
-            if (quotient.IsZero())
-            {
-                break;
-            }
-            resultInteger = quotient;
-        }
+        // split the number by powers of the base until what is left fits in 64 bits.
+        std::vector<LIMBS> powers;
+        const size_t digits = BigNumber::_BasePowers(integer, base, powers);
+        BigNumber::_ConvertLimbsToBase(integer, powers, powers.size() - 1, digits, false, base, numbers);
     }
 
     /**
-     * Convert a number to a given base, (only the fractional part).
      * Convert the fractional part of a number to the given base.
      * @see http://mathbits.com/MathBits/CompSci/Introduction/frombase10.htm
      * @see http://www.mathpath.org/concepts/Num/frac.htm
@@ -2131,46 +4005,136 @@ namespace MyOddWeb
     )
     {
         numbers.clear();
-        BigNumber resultFrac = BigNumber(givenNumber).Frac();
-        if (resultFrac.IsZero())
+
+        // only the fractional part of the number.
+        LIMBS frac(givenNumber._limbs);
+        BigNumber::_ModuloLimbsByBase(frac, givenNumber._decimals);
+        if (frac.empty() || precision == 0)
         {
             return;
         }
 
-        BigNumber bigNumberBase = base;
-        size_t actualPrecision = 0;
-
-        for (;;)
+        // rather than multiplying the fraction by the base one number at a time
+        // we multiply it by base^precision once, the integer part is all the numbers we want.
+        // 0.75 in base 2 = 75 * 2^precision / 100
+        LIMBS power, square, product;
+        power.push_back(1);
+        square.push_back(base);
+        for (size_t exponent = precision;;)
         {
-            //  have we reached a presision limit?
-            if (actualPrecision >= precision)
+            if (exponent & 1)
+            {
+                BigNumber::_MulLimbs(power, square, product);
+                power = std::move(product);
+            }
+            exponent >>= 1;
+            if (exponent == 0)
             {
                 break;
             }
+            BigNumber::_MulLimbs(square, square, product);
+            square = std::move(product);
+        }
+        BigNumber::_MulLimbs(frac, power, product);
+
+        // if the decimals are all zeros, the fraction ends before the precision
+        // and we do not want the trailing zeros.
+        const bool exact = (BigNumber::_TrailingZeros(product, givenNumber._decimals) == givenNumber._decimals);
+        BigNumber::_DevideLimbsByBase(product, givenNumber._decimals);
+
+        std::vector<LIMBS> powers;
+        const size_t digits = BigNumber::_BasePowers(product, base, powers);
+        BigNumber::_ConvertLimbsToBase(product, powers, powers.size() - 1, digits, false, base, numbers);
 
-            // the oresision we are at.
-            ++actualPrecision;
+        // add the leading zeros, 0.001 = 0.0000000001 in base 2.
+        numbers.resize(precision, 0);
 
-            // we have to use our multiplier so we don't have rounding issues.
-            // if we use double/float
-            resultFrac = BigNumber::AbsMul(resultFrac, bigNumberBase, 1000);
+        // remember that the numbers are in reverse.
+        if (exact)
+        {
+            size_t zeros = 0;
+            while (zeros < numbers.size() && numbers[zeros] == 0)
+            {
+                ++zeros;
+            }
+            numbers.erase(numbers.begin(), numbers.begin() + zeros);
+        }
+    }
 
-            // the 'number' is the integer part.
-            BigNumber remainder = BigNumber(resultFrac).Integer();
-            numbers.push_back((char)remainder.ToInt());
+    /**
+     * Get the powers of the base we will split a number with when converting it to that base.
+     * base^digits, base^(2*digits), base^(4*digits) ... where base^digits is the biggest power that fits in 64 bits.
+     * The last power is greater than the number.
+     * @param const LIMBS& limbs the number we will be converting.
+     * @param const unsigned short base the base we are converting to.
+     * @param std::vector<LIMBS>& powers the powers of the base.
+     * @return size_t the number of digits in the first power.
+     */
+    size_t BigNumber::_BasePowers(const LIMBS& limbs, const unsigned short base, std::vector<LIMBS>& powers)
+    {
+        // the biggest power of the base that fits in our 2 inline limbs.
+        size_t digits = 0;
+        unsigned long long number = 1;
+        while (number <= 999999999999999999ULL / base)
+        {
+            number *= base;
+            ++digits;
+        }
 
-            // as long as the fractional part is not zero we can continue.
-            resultFrac = BigNumber(resultFrac).Frac();
+        powers.clear();
+        powers.push_back(LIMBS());
+        BigNumber::_ULongLongToLimbs(number, powers.back());
+        while (BigNumber::_CompareLimbs(powers.back(), limbs) <= 0)
+        {
+            LIMBS square;
+            BigNumber::_MulLimbs(powers.back(), powers.back(), square);
+            powers.push_back(std::move(square));
+        }
+        return digits;
+    }
 
-            // if it is zero, then we are done
-            if (resultFrac.IsZero())
+    /**
+     * Convert a number to a given base, we split the number in 2 halves with the powers of the base
+     * and convert each half, so the number of divisions is about the same as the number of limbs.
+     * The numbers are added in reverse, the same way as the numbers in NUMBERS.
+     * @param const LIMBS& limbs the number we are converting, it is less than powers[level].
+     * @param const std::vector<LIMBS>& powers the powers of the base.
+     * @param size_t level the power we are at.
+     * @param size_t digits the number of digits in powers[0].
+     * @param bool pad if we want to add the leading zeros, (the lower half of a number needs them).
+     * @param const unsigned short base the base we are converting to.
+     * @param NUMBERS& numbers the container we are adding the numbers to.
+     */
+    void BigNumber::_ConvertLimbsToBase(const LIMBS& limbs, const std::vector<LIMBS>& powers, size_t level, size_t digits, bool pad, const unsigned short base, NUMBERS& numbers)
+    {
+        if (level == 0)
+        {
+            // the number fits in 64 bits.
+            unsigned long long number = 0;
+            BigNumber::_LimbsToULongLong(limbs, number);
+            for (size_t i = 0; number > 0 || (pad && i < digits); ++i)
             {
-                break;
+                numbers.push_back((unsigned char)(number % base));
+                number /= base;
             }
+            return;
+        }
+
+        // without the leading zeros, a number smaller than the next power does not need to be split.
+        if (!pad && BigNumber::_CompareLimbs(limbs, powers[level - 1]) < 0)
+        {
+            BigNumber::_ConvertLimbsToBase(limbs, powers, level - 1, digits, false, base, numbers);
+            return;
         }
 
-        // we now need to reverse the array as this is the way all our numbers are.
-        std::reverse(numbers.begin(), numbers.end());
+        // number = high * powers[level-1] + low
+        LIMBS high, low;
+        BigNumber::_DivModLimbs(limbs, powers[level - 1], high, &low);
+        BigNumber::_ConvertLimbsToBase(low, powers, level - 1, digits, true, base, numbers);
+        if (pad || !high.empty())
+        {
+            BigNumber::_ConvertLimbsToBase(high, powers, level - 1, digits, pad, base, numbers);
+        }
     }
 
     /**
@@ -2231,16 +4195,8 @@ namespace MyOddWeb
     */
     void BigNumber::DevideByBase(size_t divisor)
     {
-        // set the decimals
+        // set the decimals, the limbs themselves do not change.
         _decimals += divisor;
-
-        // check that the length is valid
-        size_t l = _numbers.size();
-        while (l < _decimals + 1)
-        {
-            _numbers.push_back(0);
-            ++l;
-        }
         PerformPostOperations(_decimals);
     }
 
@@ -2261,17 +4217,13 @@ namespace MyOddWeb
         }
 
         // muliply by BIGNUMBER_BASE means that we are shifting the multipliers.
-        while (_decimals > 0 && multiplier > 0) {
-            --_decimals;
-            --multiplier;
-        }
+        const size_t shift = _decimals < multiplier ? _decimals : multiplier;
+        _decimals -= shift;
+        multiplier -= shift;
 
         // if we have any multipliers left, 
         // keep moving by adding zeros.
-        for (size_t i = 0; i < multiplier; ++i)
-        {
-            _numbers.insert(_numbers.begin(), 0);
-        }
+        BigNumber::_MultiplyLimbsByBase(_limbs, multiplier);
 
         //  clean up
         PerformPostOperations(_decimals);
@@ -2282,52 +4234,307 @@ namespace MyOddWeb
      * @see http://www.miniwebtool.com/first-n-digits-of-pi/?number=1000
      * @return const BigNumber& e
      */
-    const BigNumber& BigNumber::e()
+    const BigNumber& BigNumber::e()
+    {
+        // create it once, the other threads wait for it to be created
+        // and after that it is only read, so we do not need to lock it.
+        static std::once_flag created;
+        std::call_once(created, []()
+        {
+            BigNumberNoArena noArena;
+
+            // create it now using {}, it is slightly faster than using the string parsing, (just a little).
+            // uncomment the code below if that causes an error.
+            _e = BigNumber({ 4,5,3,0,5,3,0,7,5,9,8,8,6,4,5,1,7,6,2,1,2,5,5,6,9,6,9,3,7,8,6,0,1,6,8,9,8,1,7,1,4,0,7,7,4,7,5,1,1,0,1,5,0,5,7,3,8,3,0,1,5,8,0,2,7,0,1,3,0,3,1,6,0,9,4,5,3,6,5,4,1,7,2,9,5,0,4,1,8,7,3,4,2,4,6,9,3,8,6,7,6,1,0,7,0,7,8,8,8,0,9,6,3,8,1,6,9,0,2,5,1,3,5,2,6,4,5,0,4,6,3,4,1,8,3,7,1,3,4,3,9,0,4,1,3,6,4,1,9,4,8,1,4,9,9,6,3,4,0,3,5,3,2,0,9,9,0,6,1,2,0,0,9,0,2,3,2,6,8,7,9,1,4,0,7,2,8,4,2,6,3,3,2,0,6,5,7,8,4,8,6,9,4,4,2,3,6,4,3,6,3,4,4,4,8,9,1,4,8,4,0,1,6,9,7,2,9,4,7,5,2,8,5,0,8,6,8,0,2,9,8,9,9,4,8,2,2,9,7,8,2,2,4,9,8,5,8,3,7,6,6,8,3,7,2,7,0,8,5,4,3,9,1,5,8,8,8,8,9,5,1,5,3,0,9,6,1,4,0,3,9,5,1,8,8,1,8,1,6,9,9,0,5,2,1,1,8,9,6,0,2,3,3,1,6,3,7,1,7,6,5,7,1,0,3,5,1,8,5,5,4,9,1,8,9,0,5,2,8,7,8,2,3,2,0,8,1,1,3,5,9,2,4,0,8,4,6,4,6,7,3,2,8,2,3,8,6,0,2,3,9,7,6,7,3,8,9,1,0,7,9,3,0,4,1,6,1,4,8,6,0,7,9,1,8,3,2,1,0,3,7,1,1,3,4,4,9,0,5,2,6,3,0,2,3,3,9,7,8,8,4,9,2,8,9,3,2,9,3,9,0,2,8,5,0,1,5,6,4,6,9,4,8,9,3,9,6,8,8,2,5,2,8,1,3,3,0,8,6,6,3,9,1,5,9,8,9,6,2,8,0,2,2,8,4,1,5,3,6,7,5,9,2,2,9,9,9,4,2,4,5,1,2,8,7,1,6,3,7,7,2,1,3,9,7,8,9,0,0,3,2,9,8,8,6,3,6,1,3,9,7,8,9,5,0,9,4,5,4,4,6,8,6,4,9,7,6,9,9,6,9,9,4,4,5,8,7,0,7,7,6,9,6,3,5,9,6,5,0,5,2,4,4,8,7,9,8,3,2,5,2,1,1,1,2,7,7,3,6,4,7,5,6,8,0,1,5,1,5,5,2,0,9,1,8,6,3,8,2,9,6,1,4,1,0,1,3,9,0,2,7,7,9,6,9,6,0,3,2,7,4,0,7,4,7,3,4,4,7,2,1,9,0,7,8,2,3,9,0,7,0,0,2,3,1,1,7,3,7,6,0,6,7,9,2,0,6,5,6,2,8,3,3,9,4,4,0,2,5,7,0,0,0,3,8,5,4,8,3,1,3,3,1,6,2,6,0,6,8,3,8,1,6,7,2,0,7,1,5,5,9,6,0,2,9,9,4,4,7,7,7,0,9,3,5,7,0,1,7,3,4,2,4,4,5,4,3,2,4,7,3,5,8,1,1,4,7,7,4,8,6,1,0,0,8,4,6,2,2,8,0,8,6,6,0,6,4,1,6,7,4,4,2,9,0,5,7,6,1,4,8,8,4,3,9,9,4,1,9,8,0,4,5,1,2,0,7,0,3,9,7,8,1,4,3,8,3,7,5,1,1,0,9,1,0,1,5,2,5,9,1,3,5,7,0,8,8,9,2,8,3,3,2,3,6,7,0,9,4,3,4,9,7,2,6,8,2,3,2,3,1,8,3,7,0,3,6,5,9,5,0,6,2,5,9,2,4,3,3,0,0,9,2,7,5,3,4,0,9,2,6,6,9,5,3,1,4,7,1,8,1,2,9,9,5,0,3,0,0,2,3,9,1,9,3,6,6,4,7,2,4,7,2,4,6,6,1,5,2,5,8,7,1,2,8,3,1,7,5,4,9,5,7,4,5,3,5,3,0,3,6,6,7,0,4,2,7,7,2,6,7,6,9,6,6,9,4,7,5,9,5,9,9,9,6,3,9,0,7,4,2,7,5,7,7,9,4,2,6,6,2,5,3,1,7,4,7,8,2,0,6,3,5,3,2,5,4,0,9,5,4,8,2,8,1,8,2,8,1,7,2 }, 1000, false);
+
+            // in case you cannot use NUMBERS numbers = {}
+            // _e = BigNumber("2.7182818284590452353602874713526624977572470936999595749669676277240766303535475945713821785251664274274663919320030599218174135966290435729003342952605956307381323286279434907632338298807531952510190115738341879307021540891499348841675092447614606680822648001684774118537423454424371075390777449920695517027618386062613313845830007520449338265602976067371132007093287091274437470472306969772093101416928368190255151086574637721112523897844250569536967707854499699679468644549059879316368892300987931277361782154249992295763514822082698951936680331825288693984964651058209392398294887933203625094431173012381970684161403970198376793206832823764648042953118023287825098194558153017567173613320698112509961818815930416903515988885193458072738667385894228792284998920868058257492796104841984443634632449684875602336248270419786232090021609902353043699418491463140934317381436405462531520961836908887070167683964243781405927145635490613031072085103837505101157477041718986106873969655212671546889570350354");
+        });
+
+        // return it
+        return _e;
+    }
+
+    /**
+     * The const value of pi to 1000 numbers
+     * @see https://en.wikipedia.org/wiki/E_%28mathematical_constant%29
+     * @see http://www.wolframalpha.com/input/?i=pi+to+1000+digits
+     * @return const BigNumber& pi
+    */
+    const BigNumber& BigNumber::pi()
+    {
+        // create it once, the other threads wait for it to be created
+        // and after that it is only read, so we do not need to lock it.
+        static std::once_flag created;
+        std::call_once(created, []()
+        {
+            BigNumberNoArena noArena;
+
+            // create it now using {}, it is slightly faster than using the string parsing, (just a little).
+            // uncomment the code below if that causes an error.
+            _pi = BigNumber({ 9,8,9,1,0,2,4,6,1,2,9,0,9,5,9,1,1,1,6,6,7,8,7,2,9,1,0,0,3,1,6,6,0,8,6,2,2,1,7,1,2,3,5,0,8,7,7,5,8,1,8,7,7,5,9,1,5,7,3,9,5,7,8,7,3,5,3,2,8,8,3,6,8,2,6,5,9,5,1,1,3,7,8,6,4,5,5,7,8,2,4,0,9,4,3,5,2,8,9,5,3,0,3,7,4,1,9,6,6,7,7,1,7,1,6,0,2,4,1,8,3,8,0,2,3,3,5,7,8,5,6,8,8,2,5,7,8,3,8,7,3,1,3,0,0,0,1,0,1,7,1,8,8,1,1,3,9,1,6,2,5,3,0,5,8,6,4,4,3,3,5,2,8,0,3,2,2,5,2,4,6,2,0,3,8,0,9,6,4,3,5,5,4,9,5,4,4,2,0,5,9,5,8,1,3,6,9,0,6,1,8,2,3,7,1,3,7,9,5,0,1,5,9,9,4,0,8,7,9,2,7,3,8,9,9,9,9,9,9,4,3,1,1,2,7,0,7,8,1,5,0,6,9,9,0,3,1,7,7,4,7,7,9,2,6,3,1,8,9,5,1,8,1,4,4,3,0,4,6,8,0,6,9,1,2,0,9,2,1,2,1,1,6,5,9,9,1,0,2,4,5,3,2,9,8,5,2,9,8,6,9,7,2,2,9,7,0,5,0,1,7,3,5,8,5,9,4,5,6,4,1,0,3,4,3,5,9,4,2,2,1,0,9,0,4,4,8,6,4,1,2,7,8,7,1,7,3,6,3,7,1,9,0,6,9,8,7,7,5,7,2,4,3,1,7,7,5,8,7,7,2,8,0,6,5,3,6,2,5,4,1,7,2,1,8,6,5,0,0,0,2,3,1,5,0,4,9,6,6,7,6,4,8,1,8,4,7,6,4,8,3,2,5,7,6,7,1,3,9,2,6,7,1,7,1,2,9,3,5,0,7,7,2,0,7,3,4,9,0,6,8,9,7,1,2,0,7,0,9,1,7,3,7,4,2,2,5,9,3,6,4,9,4,9,3,1,2,0,6,8,0,3,4,6,6,5,6,0,4,4,2,6,3,3,7,6,3,3,8,9,2,1,9,4,9,1,1,0,3,8,1,8,3,9,7,2,2,1,9,8,4,2,7,2,5,7,5,8,8,1,5,3,7,6,5,9,4,7,2,6,9,9,7,3,2,6,4,4,7,0,8,4,5,8,1,1,5,0,1,3,9,7,1,1,6,2,3,9,1,8,3,7,1,1,6,8,1,2,9,0,3,5,9,1,9,5,9,5,7,5,6,3,0,7,2,7,5,0,3,3,4,9,0,6,1,1,5,1,4,9,1,5,9,6,4,1,4,8,3,1,2,5,6,6,4,0,2,8,8,4,5,0,3,5,0,3,3,1,1,0,0,6,3,0,9,5,2,9,8,7,6,3,4,6,3,5,1,7,1,9,0,4,5,2,9,2,8,2,6,9,0,2,9,0,2,5,1,8,8,4,7,1,8,8,5,5,1,3,6,0,6,6,0,0,7,8,5,4,2,7,3,7,2,1,4,1,9,4,2,0,6,2,7,0,6,3,9,3,3,1,2,8,4,6,6,2,3,4,5,4,0,1,6,8,4,3,0,6,4,3,2,9,6,6,5,8,4,6,5,4,1,9,0,9,1,0,2,1,7,2,5,6,1,3,8,7,6,8,7,3,3,2,8,4,6,5,7,4,8,2,1,6,4,4,3,3,9,5,6,6,5,7,9,0,1,8,8,2,4,4,6,9,1,8,3,0,3,9,4,5,9,8,4,9,2,2,6,4,4,6,9,5,5,5,0,1,1,2,5,8,3,9,1,0,7,2,0,1,4,8,2,0,5,4,7,1,1,1,8,4,8,2,1,8,0,4,9,5,3,5,2,7,1,3,2,2,8,5,0,5,5,9,0,6,4,4,8,3,9,0,7,4,6,6,0,3,2,8,2,3,1,5,6,8,0,8,4,1,2,8,9,7,6,0,7,1,1,2,4,3,5,2,8,4,3,0,8,2,6,8,9,9,8,0,2,6,8,2,6,0,4,6,1,8,7,0,3,2,9,5,4,4,9,4,7,9,0,2,8,5,0,1,5,7,3,9,9,3,9,6,1,7,9,1,4,8,8,2,0,5,9,7,2,3,8,3,3,4,6,2,6,4,8,3,2,3,9,7,9,8,5,3,5,6,2,9,5,1,4,1,3 }, 1000, false);
+
+            // in case you cannot use NUMBERS numbers = {}
+            // _pi = BigNumber("3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679821480865132823066470938446095505822317253594081284811174502841027019385211055596446229489549303819644288109756659334461284756482337867831652712019091456485669234603486104543266482133936072602491412737245870066063155881748815209209628292540917153643678925903600113305305488204665213841469519415116094330572703657595919530921861173819326117931051185480744623799627495673518857527248912279381830119491298336733624406566430860213949463952247371907021798609437027705392171762931767523846748184676694051320005681271452635608277857713427577896091736371787214684409012249534301465495853710507922796892589235420199561121290219608640344181598136297747713099605187072113499999983729780499510597317328160963185950244594553469083026425223082533446850352619311881710100031378387528865875332083814206171776691473035982534904287554687311595628638823537875937519577818577805321712268066130019278766111959092164201989");
+        });
+
+        // return it
+        return _pi;
+    }
+
+    /**
+     * Get e with 'precision' decimals.
+     * Up to 1000 decimals this is e() truncated, after that we calculate it
+     * and keep it so we do not need to calculate it again for the same precision, (or less).
+     * Either way the number has no more than 'precision' decimals.
+     * @see _CalculateE( ... )
+     * @param size_t precision the number of decimals we want.
+     * @return BigNumber e
+     */
+    BigNumber BigNumber::e(size_t precision)
+    {
+        // do we have enough numbers already?
+        const BigNumber& c = BigNumber::e();
+        if (precision <= c._decimals)
+        {
+            return BigNumber(c).Trunc(precision);
+        }
+
+        return BigNumber(_GetConstant(_e_constant, precision, &BigNumber::_CalculateE)).Trunc(precision);
+    }
+
+    /**
+     * Get pi with 'precision' decimals.
+     * Up to 1000 decimals this is pi() truncated, after that we calculate it
+     * and keep it so we do not need to calculate it again for the same precision, (or less).
+     * Either way the number has no more than 'precision' decimals.
+     * @see _CalculatePi( ... )
+     * @param size_t precision the number of decimals we want.
+     * @return BigNumber pi
+     */
+    BigNumber BigNumber::pi(size_t precision)
+    {
+        // do we have enough numbers already?
+        const BigNumber& c = BigNumber::pi();
+        if (precision <= c._decimals)
+        {
+            return BigNumber(c).Trunc(precision);
+        }
+
+        return BigNumber(_GetConstant(_pi_constant, precision, &BigNumber::_CalculatePi)).Trunc(precision);
+    }
+
+    /**
+     * Calculate e to a given number of decimals.
+     * e = 1 + 1/1! + 1/2! + ... + 1/n!, the sum is calculated as a single fraction p/q
+     * @see https://en.wikipedia.org/wiki/Binary_splitting
+     * @param size_t precision the number of decimals we want.
+     * @return BigNumber e
+     */
+    BigNumber BigNumber::_CalculateE(size_t precision)
+    {
+        // a few more decimals so the last ones are correct.
+        const size_t decimals = precision + 10;
+
+        // we need n! > 10^decimals
+        double digits = 0;
+        unsigned long long n = 1;
+        while (digits <= (double)decimals)
+        {
+            ++n;
+            digits += std::log10((double)n);
+        }
+
+        BigNumber p, q;
+        BigNumber::_SeriesE(0, n, p, q);
+
+        // e * 10^decimals = 10^decimals + p * 10^decimals / q
+        LIMBS numerator(p._limbs);
+        BigNumber::_MultiplyLimbsByBase(numerator, decimals);
+
+        BigNumber c;
+        BigNumber::_DivModLimbs(numerator, q._limbs, c._limbs, NULL);
+        LIMBS one;
+        one.push_back(1);
+        BigNumber::_MultiplyLimbsByBase(one, decimals);
+        BigNumber::_AddLimbsAssign(c._limbs, one);
+        c._decimals = decimals;
+        return c.PerformPostOperations(precision);
+    }
+
+    /**
+     * Calculate the sum 1/(first+1) + 1/((first+1)(first+2)) + ... + 1/((first+1)...last) as p/q
+     * by splitting it in 2 halves, so we are always multiplying numbers of about the same size.
+     * @param unsigned long long first the first number, (not included).
+     * @param unsigned long long last the last number.
+     * @param BigNumber& p the numerator.
+     * @param BigNumber& q the denominator, (first+1) x ... x last.
+     */
+    void BigNumber::_SeriesE(unsigned long long first, unsigned long long last, BigNumber& p, BigNumber& q)
+    {
+        if (last - first == 1)
+        {
+            p = _number_one;
+            q = BigNumber((long long)last);
+            return;
+        }
+
+        // p/q = p1/q1 + p2/(q1*q2) = (p1*q2 + p2) / (q1*q2)
+        const unsigned long long middle = first + (last - first) / 2;
+        BigNumber p2, q2;
+        BigNumber::_SeriesE(first, middle, p, q);
+        BigNumber::_SeriesE(middle, last, p2, q2);
+        p.MulAdd(q2, p2, 0);
+        q.Mul(q2, 0);
+    }
+
+    /**
+     * Calculate pi to a given number of decimals, using the Chudnovsky algorithm.
+     * pi = 426880 * sqrt(10005) * q / t, where q and t are the sums of the series.
+     * @see https://en.wikipedia.org/wiki/Chudnovsky_algorithm
+     * @param size_t precision the number of decimals we want.
+     * @return BigNumber pi
+     */
+    BigNumber BigNumber::_CalculatePi(size_t precision)
+    {
+        // a few more decimals so the last ones are correct.
+        const size_t decimals = precision + 10;
+
+        // each term adds a little over 14 numbers.
+        const unsigned long long n = decimals / 14 + 2;
+
+        BigNumber p, q, t;
+        BigNumber::_SeriesPi(0, n, p, q, t);
+
+        // sqrt(10005) * 10^decimals = sqrt(10005 * 10^(2*decimals))
+        LIMBS number, root;
+        BigNumber::_ULongLongToLimbs(10005, number);
+        BigNumber::_MultiplyLimbsByBase(number, 2 * decimals);
+        BigNumber::_SqrtLimbs(number, root);
+
+        // pi * 10^decimals = 426880 * root * q / t
+        BigNumber numerator = BigNumber(426880).Mul(q, 0);
+        BigNumber::_MulLimbs(numerator._limbs, root, number);
+
+        BigNumber c;
+        BigNumber::_DivModLimbs(number, t._limbs, c._limbs, NULL);
+        c._decimals = decimals;
+        return c.PerformPostOperations(precision);
+    }
+
+    /**
+     * Calculate 2 * pi to a given number of decimals, used to normalize angles.
+     * @see _NormalizeAngle( ... )
+     * @param size_t precision the number of decimals we want.
+     * @return BigNumber 2 * pi
+     */
+    BigNumber BigNumber::_CalculateTwoPi(size_t precision)
+    {
+        return BigNumber::pi(precision).Mul(_number_two, precision);
+    }
+
+    /**
+     * Calculate the terms [first, last) of the Chudnovsky series
+     * by splitting it in 2 halves, so we are always multiplying numbers of about the same size.
+     * @see https://en.wikipedia.org/wiki/Chudnovsky_algorithm
+     * @param unsigned long long first the first term.
+     * @param unsigned long long last the last term, (not included).
+     * @param BigNumber& p the product of (6k-5)(2k-1)(6k-1)
+     * @param BigNumber& q the product of k^3 * 640320^3 / 24
+     * @param BigNumber& t the sum of the terms.
+     */
+    void BigNumber::_SeriesPi(unsigned long long first, unsigned long long last, BigNumber& p, BigNumber& q, BigNumber& t)
     {
-        //  did we calculate e already?
-        if (_e._decimals != 0)
+        if (last - first == 1)
         {
-            return _e;
-        }
-
-        // create it now using {}, it is slightly faster than using the string parsing, (just a little).
-        // uncomment the code below if that causes an error.
-        _e = BigNumber({ 4,5,3,0,5,3,0,7,5,9,8,8,6,4,5,1,7,6,2,1,2,5,5,6,9,6,9,3,7,8,6,0,1,6,8,9,8,1,7,1,4,0,7,7,4,7,5,1,1,0,1,5,0,5,7,3,8,3,0,1,5,8,0,2,7,0,1,3,0,3,1,6,0,9,4,5,3,6,5,4,1,7,2,9,5,0,4,1,8,7,3,4,2,4,6,9,3,8,6,7,6,1,0,7,0,7,8,8,8,0,9,6,3,8,1,6,9,0,2,5,1,3,5,2,6,4,5,0,4,6,3,4,1,8,3,7,1,3,4,3,9,0,4,1,3,6,4,1,9,4,8,1,4,9,9,6,3,4,0,3,5,3,2,0,9,9,0,6,1,2,0,0,9,0,2,3,2,6,8,7,9,1,4,0,7,2,8,4,2,6,3,3,2,0,6,5,7,8,4,8,6,9,4,4,2,3,6,4,3,6,3,4,4,4,8,9,1,4,8,4,0,1,6,9,7,2,9,4,7,5,2,8,5,0,8,6,8,0,2,9,8,9,9,4,8,2,2,9,7,8,2,2,4,9,8,5,8,3,7,6,6,8,3,7,2,7,0,8,5,4,3,9,1,5,8,8,8,8,9,5,1,5,3,0,9,6,1,4,0,3,9,5,1,8,8,1,8,1,6,9,9,0,5,2,1,1,8,9,6,0,2,3,3,1,6,3,7,1,7,6,5,7,1,0,3,5,1,8,5,5,4,9,1,8,9,0,5,2,8,7,8,2,3,2,0,8,1,1,3,5,9,2,4,0,8,4,6,4,6,7,3,2,8,2,3,8,6,0,2,3,9,7,6,7,3,8,9,1,0,7,9,3,0,4,1,6,1,4,8,6,0,7,9,1,8,3,2,1,0,3,7,1,1,3,4,4,9,0,5,2,6,3,0,2,3,3,9,7,8,8,4,9,2,8,9,3,2,9,3,9,0,2,8,5,0,1,5,6,4,6,9,4,8,9,3,9,6,8,8,2,5,2,8,1,3,3,0,8,6,6,3,9,1,5,9,8,9,6,2,8,0,2,2,8,4,1,5,3,6,7,5,9,2,2,9,9,9,4,2,4,5,1,2,8,7,1,6,3,7,7,2,1,3,9,7,8,9,0,0,3,2,9,8,8,6,3,6,1,3,9,7,8,9,5,0,9,4,5,4,4,6,8,6,4,9,7,6,9,9,6,9,9,4,4,5,8,7,0,7,7,6,9,6,3,5,9,6,5,0,5,2,4,4,8,7,9,8,3,2,5,2,1,1,1,2,7,7,3,6,4,7,5,6,8,0,1,5,1,5,5,2,0,9,1,8,6,3,8,2,9,6,1,4,1,0,1,3,9,0,2,7,7,9,6,9,6,0,3,2,7,4,0,7,4,7,3,4,4,7,2,1,9,0,7,8,2,3,9,0,7,0,0,2,3,1,1,7,3,7,6,0,6,7,9,2,0,6,5,6,2,8,3,3,9,4,4,0,2,5,7,0,0,0,3,8,5,4,8,3,1,3,3,1,6,2,6,0,6,8,3,8,1,6,7,2,0,7,1,5,5,9,6,0,2,9,9,4,4,7,7,7,0,9,3,5,7,0,1,7,3,4,2,4,4,5,4,3,2,4,7,3,5,8,1,1,4,7,7,4,8,6,1,0,0,8,4,6,2,2,8,0,8,6,6,0,6,4,1,6,7,4,4,2,9,0,5,7,6,1,4,8,8,4,3,9,9,4,1,9,8,0,4,5,1,2,0,7,0,3,9,7,8,1,4,3,8,3,7,5,1,1,0,9,1,0,1,5,2,5,9,1,3,5,7,0,8,8,9,2,8,3,3,2,3,6,7,0,9,4,3,4,9,7,2,6,8,2,3,2,3,1,8,3,7,0,3,6,5,9,5,0,6,2,5,9,2,4,3,3,0,0,9,2,7,5,3,4,0,9,2,6,6,9,5,3,1,4,7,1,8,1,2,9,9,5,0,3,0,0,2,3,9,1,9,3,6,6,4,7,2,4,7,2,4,6,6,1,5,2,5,8,7,1,2,8,3,1,7,5,4,9,5,7,4,5,3,5,3,0,3,6,6,7,0,4,2,7,7,2,6,7,6,9,6,6,9,4,7,5,9,5,9,9,9,6,3,9,0,7,4,2,7,5,7,7,9,4,2,6,6,2,5,3,1,7,4,7,8,2,0,6,3,5,3,2,5,4,0,9,5,4,8,2,8,1,8,2,8,1,7,2 }, 1000, false);
+            if (first == 0)
+            {
+                p = _number_one;
+                q = _number_one;
+            }
+            else
+            {
+                const long long k = (long long)first;
+                p = BigNumber(6 * k - 5).Mul(BigNumber(2 * k - 1), 0).Mul(BigNumber(6 * k - 1), 0);
+                q = BigNumber(k).Mul(BigNumber(k), 0).Mul(BigNumber(k), 0).Mul(BigNumber(10939058860032000LL), 0);
+            }
 
-        // in case you cannot use NUMBERS numbers = {}
-        // _e = BigNumber("2.7182818284590452353602874713526624977572470936999595749669676277240766303535475945713821785251664274274663919320030599218174135966290435729003342952605956307381323286279434907632338298807531952510190115738341879307021540891499348841675092447614606680822648001684774118537423454424371075390777449920695517027618386062613313845830007520449338265602976067371132007093287091274437470472306969772093101416928368190255151086574637721112523897844250569536967707854499699679468644549059879316368892300987931277361782154249992295763514822082698951936680331825288693984964651058209392398294887933203625094431173012381970684161403970198376793206832823764648042953118023287825098194558153017567173613320698112509961818815930416903515988885193458072738667385894228792284998920868058257492796104841984443634632449684875602336248270419786232090021609902353043699418491463140934317381436405462531520961836908887070167683964243781405927145635490613031072085103837505101157477041718986106873969655212671546889570350354");
+            // t = p * (13591409 + 545140134 * k) * (-1)^k
+            t = BigNumber(p).Mul(BigNumber((long long)first).MulAdd(545140134LL, 13591409, 0), 0);
+            if (first & 1)
+            {
+                t._neg = !t._neg;
+            }
+            return;
+        }
 
-        // return it
-        return _e;
+        // p = p1 * p2, q = q1 * q2 and t = t1 * q2 + p1 * t2
+        const unsigned long long middle = first + (last - first) / 2;
+        BigNumber p2, q2, t2;
+        BigNumber::_SeriesPi(first, middle, p, q, t);
+        BigNumber::_SeriesPi(middle, last, p2, q2, t2);
+        t.MulAdd(q2, BigNumber(p).Mul(t2, 0), 0);
+        p.Mul(p2, 0);
+        q.Mul(q2, 0);
     }
 
     /**
-     * The const value of pi to 1000 numbers
-     * @see https://en.wikipedia.org/wiki/E_%28mathematical_constant%29
-     * @see http://www.wolframalpha.com/input/?i=pi+to+1000+digits
-     * @return const BigNumber& pi
-    */
-    const BigNumber& BigNumber::pi()
+     * Calculate the integer square root of a number, floor(sqrt(limbs))
+     * We work out the root of the top half of the number first, then use Newton's method
+     * x = (x + limbs/x) / 2 until it stops getting smaller.
+     * @see https://en.wikipedia.org/wiki/Integer_square_root
+     * @param const LIMBS& limbs the number.
+     * @param LIMBS& root the square root.
+     */
+    void BigNumber::_SqrtLimbs(const LIMBS& limbs, LIMBS& root)
     {
-        //  did we calculate e already?
-        if (_pi._decimals != 0)
+        unsigned long long number;
+        if (BigNumber::_LimbsToULongLong(limbs, number))
         {
-            return _pi;
+            unsigned long long x = (unsigned long long)std::sqrt((double)number);
+            while (x * x > number)
+            {
+                --x;
+            }
+            while ((x + 1) * (x + 1) <= number)
+            {
+                ++x;
+            }
+            BigNumber::_ULongLongToLimbs(x, root);
+            return;
         }
 
-        // create it now using {}, it is slightly faster than using the string parsing, (just a little).
-        // uncomment the code below if that causes an error.
-        _pi = BigNumber({ 9,8,9,1,0,2,4,6,1,2,9,0,9,5,9,1,1,1,6,6,7,8,7,2,9,1,0,0,3,1,6,6,0,8,6,2,2,1,7,1,2,3,5,0,8,7,7,5,8,1,8,7,7,5,9,1,5,7,3,9,5,7,8,7,3,5,3,2,8,8,3,6,8,2,6,5,9,5,1,1,3,7,8,6,4,5,5,7,8,2,4,0,9,4,3,5,2,8,9,5,3,0,3,7,4,1,9,6,6,7,7,1,7,1,6,0,2,4,1,8,3,8,0,2,3,3,5,7,8,5,6,8,8,2,5,7,8,3,8,7,3,1,3,0,0,0,1,0,1,7,1,8,8,1,1,3,9,1,6,2,5,3,0,5,8,6,4,4,3,3,5,2,8,0,3,2,2,5,2,4,6,2,0,3,8,0,9,6,4,3,5,5,4,9,5,4,4,2,0,5,9,5,8,1,3,6,9,0,6,1,8,2,3,7,1,3,7,9,5,0,1,5,9,9,4,0,8,7,9,2,7,3,8,9,9,9,9,9,9,4,3,1,1,2,7,0,7,8,1,5,0,6,9,9,0,3,1,7,7,4,7,7,9,2,6,3,1,8,9,5,1,8,1,4,4,3,0,4,6,8,0,6,9,1,2,0,9,2,1,2,1,1,6,5,9,9,1,0,2,4,5,3,2,9,8,5,2,9,8,6,9,7,2,2,9,7,0,5,0,1,7,3,5,8,5,9,4,5,6,4,1,0,3,4,3,5,9,4,2,2,1,0,9,0,4,4,8,6,4,1,2,7,8,7,1,7,3,6,3,7,1,9,0,6,9,8,7,7,5,7,2,4,3,1,7,7,5,8,7,7,2,8,0,6,5,3,6,2,5,4,1,7,2,1,8,6,5,0,0,0,2,3,1,5,0,4,9,6,6,7,6,4,8,1,8,4,7,6,4,8,3,2,5,7,6,7,1,3,9,2,6,7,1,7,1,2,9,3,5,0,7,7,2,0,7,3,4,9,0,6,8,9,7,1,2,0,7,0,9,1,7,3,7,4,2,2,5,9,3,6,4,9,4,9,3,1,2,0,6,8,0,3,4,6,6,5,6,0,4,4,2,6,3,3,7,6,3,3,8,9,2,1,9,4,9,1,1,0,3,8,1,8,3,9,7,2,2,1,9,8,4,2,7,2,5,7,5,8,8,1,5,3,7,6,5,9,4,7,2,6,9,9,7,3,2,6,4,4,7,0,8,4,5,8,1,1,5,0,1,3,9,7,1,1,6,2,3,9,1,8,3,7,1,1,6,8,1,2,9,0,3,5,9,1,9,5,9,5,7,5,6,3,0,7,2,7,5,0,3,3,4,9,0,6,1,1,5,1,4,9,1,5,9,6,4,1,4,8,3,1,2,5,6,6,4,0,2,8,8,4,5,0,3,5,0,3,3,1,1,0,0,6,3,0,9,5,2,9,8,7,6,3,4,6,3,5,1,7,1,9,0,4,5,2,9,2,8,2,6,9,0,2,9,0,2,5,1,8,8,4,7,1,8,8,5,5,1,3,6,0,6,6,0,0,7,8,5,4,2,7,3,7,2,1,4,1,9,4,2,0,6,2,7,0,6,3,9,3,3,1,2,8,4,6,6,2,3,4,5,4,0,1,6,8,4,3,0,6,4,3,2,9,6,6,5,8,4,6,5,4,1,9,0,9,1,0,2,1,7,2,5,6,1,3,8,7,6,8,7,3,3,2,8,4,6,5,7,4,8,2,1,6,4,4,3,3,9,5,6,6,5,7,9,0,1,8,8,2,4,4,6,9,1,8,3,0,3,9,4,5,9,8,4,9,2,2,6,4,4,6,9,5,5,5,0,1,1,2,5,8,3,9,1,0,7,2,0,1,4,8,2,0,5,4,7,1,1,1,8,4,8,2,1,8,0,4,9,5,3,5,2,7,1,3,2,2,8,5,0,5,5,9,0,6,4,4,8,3,9,0,7,4,6,6,0,3,2,8,2,3,1,5,6,8,0,8,4,1,2,8,9,7,6,0,7,1,1,2,4,3,5,2,8,4,3,0,8,2,6,8,9,9,8,0,2,6,8,2,6,0,4,6,1,8,7,0,3,2,9,5,4,4,9,4,7,9,0,2,8,5,0,1,5,7,3,9,9,3,9,6,1,7,9,1,4,8,8,2,0,5,9,7,2,3,8,3,3,4,6,2,6,4,8,3,2,3,9,7,9,8,5,3,5,6,2,9,5,1,4,1,3 }, 1000, false);
-
-        // in case you cannot use NUMBERS numbers = {}
-        // _pi = BigNumber("3.1415926535897932384626433832795028841971693993751058209749445923078164062862089986280348253421170679821480865132823066470938446095505822317253594081284811174502841027019385211055596446229489549303819644288109756659334461284756482337867831652712019091456485669234603486104543266482133936072602491412737245870066063155881748815209209628292540917153643678925903600113305305488204665213841469519415116094330572703657595919530921861173819326117931051185480744623799627495673518857527248912279381830119491298336733624406566430860213949463952247371907021798609437027705392171762931767523846748184676694051320005681271452635608277857713427577896091736371787214684409012249534301465495853710507922796892589235420199561121290219608640344181598136297747713099605187072113499999983729780499510597317328160963185950244594553469083026425223082533446850352619311881710100031378387528865875332083814206171776691473035982534904287554687311595628638823537875937519577818577805321712268066130019278766111959092164201989");
-
-        // return it
-        return _pi;
+        // the root of the top of the number, sqrt(limbs / BIGNUMBER_LIMB_BASE^(2*half)) * BIGNUMBER_LIMB_BASE^half
+        // plus one, so we start above the root.
+        const size_t half = limbs.size() < 4 ? 1 : limbs.size() / 4;
+        LIMBS top, one, x;
+        one.push_back(1);
+        BigNumber::_SliceLimbs(limbs, 2 * half, limbs.size(), top);
+        BigNumber::_SqrtLimbs(top, x);
+        BigNumber::_AddLimbsAssign(x, one);
+        x.insert(x.begin(), half, 0);
+
+        LIMBS quotient, y;
+        for (;;)
+        {
+            // y = (x + limbs/x) / 2
+            BigNumber::_DivModLimbs(limbs, x, quotient, NULL);
+            BigNumber::_AddLimbs(x, quotient, y);
+            BigNumber::_DevideLimbs(y, 2);
+            if (BigNumber::_CompareLimbs(y, x) >= 0)
+            {
+                break;
+            }
+            x = std::move(y);
+        }
+        root = std::move(x);
     }
 
     /**
      * Raise e to the power of this.
+     * The integer part is e^n, the fraction part is reduced by dividing it by 2^k
+     * so the series converges quickly, and the result is then squared k times.
+     * @see https://en.wikipedia.org/wiki/Exponential_function#Computation
      * @param size_t precision the presision we want to return this to (default = DEFAULT_PRECISION).
      * @return BigNumber& e raised to the power of *this.
      */
@@ -2351,6 +4558,15 @@ namespace MyOddWeb
         BigNumber fraction(*this);
         fraction.Frac();
 
+        // e^n has about n*log10(e) whole numbers, we need that many more decimals
+        // for the fraction and for e itself so the whole number is correct to the precision.
+        size_t digits = 0;
+        if (!integer.IsZero() && !integer.IsNeg())
+        {
+            const double n = integer.ToDouble();
+            digits = (size_t)(n * 0.4342944819 + std::log10(n)) + 2;
+        }
+
         // reset this to 1
         *this = _number_one;
 
@@ -2359,50 +4575,55 @@ namespace MyOddWeb
         if (!integer.IsZero())
         {
             // get the value of e
-            BigNumber e = BigNumber::e();
-
-            // truncate the presision so we do not do too many multiplications.
-            // add a bit of room for more accurate precision.
-            e.Trunc(BIGNUMBER_PRECISION_PADDED(precision));
+            const size_t decimals = BIGNUMBER_PRECISION_PADDED(precision) + digits;
+            BigNumber e = BigNumber::e(decimals);
 
             //  then raise it.
-            *this = e.Pow(integer, BIGNUMBER_PRECISION_PADDED(precision));
+            *this = e.Pow(integer, decimals);
         }
 
         if (!fraction.IsZero())
         {
+            // the more we reduce the fraction the fewer terms we need, but the more we need to square it after.
+            // we want x / 2^k < 10^-reduce, but enough that we do not run out of iterations.
+            const size_t padded = BIGNUMBER_PRECISION_PADDED(precision) + digits;
+            const size_t reduce = std::max((size_t)std::sqrt(padded / 3.3219), padded / (BIGNUMBER_MAX_EXP_ITERATIONS - 10)) + 1;
+            const size_t halvings = (size_t)(reduce * 3.3219) + 1;
+
+            // each squaring doubles the error, so we need log10(2^k) more decimals.
+            const size_t decimals = padded + halvings / 3 + 2;
+
+            // x / 2^k
+            const BigNumber base = BigNumber(fraction).Div(BigNumber::AbsPow(_number_two, BigNumber((long long)halvings), 0), decimals);
+
             //     x^1   x^2   x^3
             // 1 + --- + --- + --- ...
             //      1!    2!    3!
-            BigNumber fact(_number_one);
-            const BigNumber base(fraction);
-            BigNumber power(base);
-
+            // each term is the previous one * x / i, the smaller the term, the fewer limbs it has.
+            BigNumber term(_number_one);
             BigNumber result = _number_one;
             for (size_t i = 1; i < BIGNUMBER_MAX_EXP_ITERATIONS; ++i)
             {
                 //  calculate the number up to the precision we are after.
-                BigNumber calulatedNumber = BigNumber(power).Div(fact, BIGNUMBER_PRECISION_PADDED(precision));
-                if (calulatedNumber.IsZero())
+                term.Mul(base, decimals).Div(BigNumber((long long)i), decimals);
+                if (term.IsZero())
                 {
                     break;
                 }
 
                 // add it to our number.
-                result.Add(calulatedNumber);
-
-                // x * x * x ...
-                power.Mul(base, BIGNUMBER_PRECISION_PADDED(precision));
-
-                //  1 * 2 * 3 ...
-                fact.Mul((int)(i + 1), BIGNUMBER_PRECISION_PADDED(precision));
+                result.Add(term);
             }
 
-            //  the decimal part of the number.
-            fraction = result;
+            // e^x = (e^(x/2^k))^(2^k)
+            for (size_t i = 0; i < halvings; ++i)
+            {
+                result.Mul(result, decimals);
+            }
 
-            // multiply the decimal number with the fraction.
-            Mul(fraction, BIGNUMBER_PRECISION_PADDED(precision));
+            // multiply the whole number with the fraction,
+            // (the fraction needs the extra decimals as it is multiplied by e^n).
+            Mul(result, padded);
         }
 
         // clean up and return.
@@ -2410,18 +4631,19 @@ namespace MyOddWeb
     }
 
     /**
-     * @see http://stackoverflow.com/questions/4657468/fast-fixed-point-pow-log-exp-and-sqrt
-     * @see http://www.convict.lu/Jeunes/ultimate_stuff/exp_ln_2.htm
-     * @see http://www.netlib.org/cephes/qlibdoc.html#qlog
-     * @see https://en.wikipedia.org/wiki/Logarithm
+     * @see https://en.wikipedia.org/wiki/Natural_logarithm#High_precision
+     * @see https://en.wikipedia.org/wiki/Halley%27s_method
      * Get the logarithm function of the current function.
+     * We start with the double estimate of ln(x) and improve it with Halley's method,
+     * y = y + 2 * (x - e^y) / (x + e^y), each step triples the number of correct decimals
+     * so each step only needs 3 times the decimals of the previous one.
      * @param size_t precision the max number of decimals.
      * @return BigNumber& this number base 10 log.
      */
     BigNumber& BigNumber::Ln(size_t precision)
     {
         // sanity checks
-        if (IsNeg())
+        if (IsNeg() || IsZero())
         {
             *this = BigNumber("NaN");
             return PerformPostOperations(precision);
@@ -2434,103 +4656,52 @@ namespace MyOddWeb
             return PerformPostOperations(precision);
         }
 
-        // @see https://www.quora.com/How-can-we-calculate-the-logarithms-by-hand-without-using-any-calculatorhttps://www.quora.com/How-can-we-calculate-the-logarithms-by-hand-without-using-any-calculator
-        // @see https://www.mathsisfun.com/algebra/logarithms.html
-
-        long long counter1 = 0;
-        long long counter2 = 0;
-        long long counter8 = 0;
-
-        static const BigNumber zeropeight = BigNumber({ 8,0 }, 1, false);
-        static const BigNumber onepeight = BigNumber({ 8,1 }, 1, false);
-        while (Compare(zeropeight) < 0)
-        {
-            Mul(onepeight, BIGNUMBER_PRECISION_PADDED(precision));
-            ++counter8;
-        }
-        while (Compare(_number_two) > 0)
-        {
-            Div(_number_two, BIGNUMBER_PRECISION_PADDED(precision));
-            ++counter2;
-        }
-
-        static const BigNumber onepone = BigNumber({ 1,1 }, 1, false);
-        while (Compare(onepone) > 0)
+        // the first estimate, from the first limbs of the number and the number of limbs.
+        // x = top * 10^exponent
+        const size_t size = _limbs.size();
+        double top = (double)_limbs[size - 1];
+        long long exponent = (long long)((size - 1) * BIGNUMBER_LIMB_DIGITS) - (long long)_decimals;
+        if (size > 1)
         {
-            Div(onepone, BIGNUMBER_PRECISION_PADDED(precision));
-            ++counter1;
+            top = top * BIGNUMBER_LIMB_BASE + (double)_limbs[size - 2];
+            exponent -= (long long)BIGNUMBER_LIMB_DIGITS;
         }
+        const double estimate = std::log(top) + (double)exponent * 2.302585092994046;
 
-        //  we must make sure that *is 
-        const BigNumber base = BigNumber(*this).Sub(_number_one); // Base of the numerator; exponent will be explicit
-        BigNumber den(_number_one);                // Denominator of the nth term
-        bool neg = false;                     // start positive.
-
-        //                  (x-1)^2    (x-1)^3   (x-1)^4 
-        // ln(x) = (x-1) - --------- + ------- - ------- ...
-        //                     2          3         4
-        BigNumber result = base;            // Kick it off
-        BigNumber baseRaised = base;
-        for (size_t i = 0; i < BIGNUMBER_MAX_LN_ITERATIONS; ++i)
-        {
-            // next denominator
-            den.Add(_number_one);
-
-            // swap operation
-            neg = !neg;
-
-            // the denominator+power is the same thing
-            baseRaised.Mul(base, BIGNUMBER_PRECISION_PADDED(precision));
-
-            // now divide it
-            BigNumber currentBase = BigNumber(baseRaised).Div(den, BIGNUMBER_PRECISION_PADDED(precision));
-
-            // there is no need to go further, with this precision
-            // and with this number of iterations we will keep adding/subtracting zeros.
-            if (currentBase.IsZero())
-            {
-                break;
-            }
-
-            // and add it/subtract it from the result.
-            if (neg)
-            {
-                result.Sub(currentBase);
-            }
-            else
-            {
-                result.Add(currentBase);
-            }
-        }
+        // the larger or the smaller the number, the more decimals we need
+        // for e^y to be as precise as this number.
+        const size_t digits = (size_t)(std::fabs(estimate) / 2.302585092994046) + 2;
 
-        // log rules are... ln(ab) = ln(a) + ln(b)
-        if (counter1 > 0)
+        // the precision of each step, from the last one to the first one.
+        std::vector<size_t> steps;
+        for (size_t step = BIGNUMBER_PRECISION_PADDED(precision); step > 9; step = step / 3 + 3)
         {
-            // "0.0953101798043248600439521232807650922206053653086441991852398081630010142358842328390575029130364930727479418458517498888460436935129806386890150217023263755687346983551204157456607731117050481406611584967219092627683199972666804124629171163211396201386277872575289851216418802049468841988934550053918259553296705084248072320206243393647990631942365020716424972582488628309770740635849277971589257686851592941134955982468458204470563781108676951416362518738052421687452698243540081779470585025890580291528650263570516836272082869034439007178525831485094480503205465208833580782304569935437696233763597527612962802333"
-            static const BigNumber ln11({ 3,3,3,2,0,8,2,6,9,2,1,6,7,2,5,7,9,5,3,6,7,3,3,2,6,9,6,7,3,4,5,3,9,9,6,5,4,0,3,2,8,7,0,8,5,3,3,8,8,0,2,5,6,4,5,0,2,3,0,5,0,8,4,4,9,0,5,8,4,1,3,8,5,2,5,8,7,1,7,0,0,9,3,4,4,3,0,9,6,8,2,8,0,2,7,2,6,3,8,6,1,5,0,7,5,3,6,2,0,5,6,8,2,5,1,9,2,0,8,5,0,9,8,5,2,0,5,8,5,0,7,4,9,7,7,1,8,0,0,4,5,3,4,2,8,9,6,2,5,4,7,8,6,1,2,4,2,5,0,8,3,7,8,1,5,2,6,3,6,1,4,1,5,9,6,7,6,8,0,1,1,8,7,3,6,5,0,7,4,4,0,2,8,5,4,8,6,4,2,8,9,5,5,9,4,3,1,1,4,9,2,9,5,1,5,8,6,8,6,7,5,2,9,8,5,1,7,9,7,7,2,9,4,8,5,3,6,0,4,7,0,7,7,9,0,3,8,2,6,8,8,4,2,8,5,2,7,9,4,2,4,6,1,7,0,2,0,5,6,3,2,4,9,1,3,6,0,9,9,7,4,6,3,9,3,3,4,2,6,0,2,0,2,3,2,7,0,8,4,2,4,8,0,5,0,7,6,9,2,3,5,5,9,5,2,8,1,9,3,5,0,0,5,5,4,3,9,8,8,9,1,4,8,8,6,4,9,4,0,2,0,8,8,1,4,6,1,2,1,5,8,9,8,2,5,7,5,2,7,8,7,7,2,6,8,3,1,0,2,6,9,3,1,1,2,3,6,1,1,7,1,9,2,6,4,2,1,4,0,8,6,6,6,2,7,9,9,9,1,3,8,6,7,2,6,2,9,0,9,1,2,7,6,9,4,8,5,1,1,6,6,0,4,1,8,4,0,5,0,7,1,1,1,3,7,7,0,6,6,5,4,7,5,1,4,0,2,1,5,5,3,8,9,6,4,3,7,8,6,5,5,7,3,6,2,3,2,0,7,1,2,0,5,1,0,9,8,6,8,3,6,0,8,9,2,1,5,3,9,6,3,4,0,6,4,8,8,8,8,9,4,7,1,5,8,5,4,8,1,4,9,7,4,7,2,7,0,3,9,4,6,3,0,3,1,9,2,0,5,7,5,0,9,3,8,2,3,2,4,8,8,5,3,2,4,1,0,1,0,0,3,6,1,8,0,8,9,3,2,5,8,1,9,9,1,4,4,6,8,0,3,5,6,3,5,0,6,0,2,2,2,9,0,5,6,7,0,8,2,3,2,1,2,5,9,3,4,0,0,6,8,4,2,3,4,0,8,9,7,1,0,1,3,5,9,0,0 }, 616, false);
-            BigNumber ln11_tmp = ln11;
-            ln11_tmp.Mul(counter1, BIGNUMBER_PRECISION_PADDED(precision));
-            result.Add(ln11_tmp);
+            steps.push_back(step);
         }
-
-        // log rules are... ln(ab) = ln(a) + ln(b)
-        if (counter2 > 0)
+        if (steps.empty() || steps.back() > 9)
         {
-            // "0.693147180559945309417232121458176568075500134360255254120680009493393621969694715605863326996418687542001481020570685733685520235758130557032670751635075961930727570828371435190307038623891673471123350115364497955239120475172681574932065155524734139525882950453007095326366642654104239157814952043740430385500801944170641671518644712839968171784546957026271631064546150257207402481637773389638550695260668341137273873722928956493547025762652098859693201965058554764703306793654432547632744951250406069438147104689946506220167720424524529612687946546193165174681392672504103802546259656869144192871608293803172714368"
-            static const BigNumber ln2({ 8,6,3,4,1,7,2,7,1,3,0,8,3,9,2,8,0,6,1,7,8,2,9,1,4,4,1,9,6,8,6,5,6,9,5,2,6,4,5,2,0,8,3,0,1,4,0,5,2,7,6,2,9,3,1,8,6,4,7,1,5,6,1,3,9,1,6,4,5,6,4,9,7,8,6,2,1,6,9,2,5,4,2,5,4,2,4,0,2,7,7,6,1,0,2,2,6,0,5,6,4,9,9,8,6,4,0,1,7,4,1,8,3,4,9,6,0,6,0,4,0,5,2,1,5,9,4,4,7,2,3,6,7,4,5,2,3,4,4,5,6,3,9,7,6,0,3,3,0,7,4,6,7,4,5,5,8,5,0,5,6,9,1,0,2,3,9,6,9,5,8,8,9,0,2,5,6,2,6,7,5,2,0,7,4,5,3,9,4,6,5,9,8,2,9,2,2,7,3,7,8,3,7,2,7,3,1,1,4,3,8,6,6,0,6,2,5,9,6,0,5,5,8,3,6,9,8,3,3,7,7,7,3,6,1,8,4,2,0,4,7,0,2,7,5,2,0,5,1,6,4,5,4,6,0,1,3,6,1,7,2,6,2,0,7,5,9,6,4,5,4,8,7,1,7,1,8,6,9,9,3,8,2,1,7,4,4,6,8,1,5,1,7,6,1,4,6,0,7,1,4,4,9,1,0,8,0,0,5,5,8,3,0,3,4,0,4,7,3,4,0,2,5,9,4,1,8,7,5,1,9,3,2,4,0,1,4,5,6,2,4,6,6,6,3,6,2,3,5,9,0,7,0,0,3,5,4,0,5,9,2,8,8,5,2,5,9,3,1,4,3,7,4,2,5,5,5,1,5,6,0,2,3,9,4,7,5,1,8,6,2,7,1,5,7,4,0,2,1,9,3,2,5,5,9,7,9,4,4,6,3,5,1,1,0,5,3,3,2,1,1,7,4,3,7,6,1,9,8,3,2,6,8,3,0,7,0,3,0,9,1,5,3,4,1,7,3,8,2,8,0,7,5,7,2,7,0,3,9,1,6,9,5,7,0,5,3,6,1,5,7,0,7,6,2,3,0,7,5,5,0,3,1,8,5,7,5,3,2,0,2,5,5,8,6,3,3,7,5,8,6,0,7,5,0,2,0,1,8,4,1,0,0,2,4,5,7,8,6,8,1,4,6,9,9,6,2,3,3,6,8,5,0,6,5,1,7,4,9,6,9,6,9,1,2,6,3,9,3,3,9,4,9,0,0,0,8,6,0,2,1,4,5,2,5,5,2,0,6,3,4,3,1,0,0,5,5,7,0,8,6,5,6,7,1,8,5,4,1,2,1,2,3,2,7,1,4,9,0,3,5,4,9,9,5,5,0,8,1,7,4,1,3,9,6,0 }, 615, false);
-            BigNumber ln2_tmp = ln2;
-            ln2_tmp.Mul(counter2, BIGNUMBER_PRECISION_PADDED(precision));
-            result.Add(ln2_tmp);
+            steps.push_back(9);
         }
 
-        // log rules are... ln(ab) = ln(a) + ln(b)
-        if (counter8 > 0)
+        // the estimate is a double, we want it in fixed notation.
+        std::ostringstream strs;
+        strs.setf(std::ios::fixed);
+        strs.precision(15);
+        strs << estimate;
+        BigNumber result(strs.str().c_str());
+
+        // the first step is done twice, in case the double estimate was not quite 9 decimals.
+        steps.push_back(steps.back());
+        for (std::vector<size_t>::const_reverse_iterator it = steps.rbegin(); it != steps.rend(); ++it)
         {
-            // "0.587786664902119008189731140618863769769379761376981181556740775800809598729560169117097631534284566775973755110200168585012003222536363442471987124070849093654145900869579488705254541486380394750214985439990943264901458147307801981343725602329350916457819213072437061657645370725998495814483186568232484236059984884946504043108616216273293809193522251042201711480828917893925532893803444719889512011504399314051421418444171441064659998892289089035003091141787128108024952008593307276614322356640449112819566260840792601819695518817384830430694637551056654910817069372465364862878039189497360001395678426943344493527"
-            static const BigNumber ln18({ 7,2,5,3,9,4,4,4,3,3,4,9,6,2,4,8,7,6,5,9,3,1,0,0,0,6,3,7,9,4,9,8,1,9,3,0,8,7,8,2,6,8,4,6,3,5,6,4,2,7,3,9,6,0,7,1,8,0,1,9,4,5,6,6,5,0,1,5,5,7,3,6,4,9,6,0,3,4,0,3,8,4,8,3,7,1,8,8,1,5,5,9,6,9,1,8,1,0,6,2,9,7,0,4,8,0,6,2,6,6,5,9,1,8,2,1,1,9,4,4,0,4,6,6,5,3,2,2,3,4,1,6,6,7,2,7,0,3,3,9,5,8,0,0,2,5,9,4,2,0,8,0,1,8,2,1,7,8,7,1,4,1,1,9,0,3,0,0,5,3,0,9,8,0,9,8,2,2,9,8,8,9,9,9,5,6,4,6,0,1,4,4,1,7,1,4,4,4,8,1,4,1,2,4,1,5,0,4,1,3,9,9,3,4,0,5,1,1,0,2,1,5,9,8,8,9,1,7,4,4,4,3,0,8,3,9,8,2,3,5,5,2,9,3,9,8,7,1,9,8,2,8,0,8,4,1,1,7,1,0,2,2,4,0,1,5,2,2,2,5,3,9,1,9,0,8,3,9,2,3,7,2,6,1,2,6,1,6,8,0,1,3,4,0,4,0,5,6,4,9,4,8,8,4,8,9,9,5,0,6,3,2,4,8,4,2,3,2,8,6,5,6,8,1,3,8,4,4,1,8,5,9,4,8,9,9,5,2,7,0,7,3,5,4,6,7,5,6,1,6,0,7,3,4,2,7,0,3,1,2,9,1,8,7,5,4,6,1,9,0,5,3,9,2,3,2,0,6,5,2,7,3,4,3,1,8,9,1,0,8,7,0,3,7,4,1,8,5,4,1,0,9,4,6,2,3,4,9,0,9,9,9,3,4,5,8,9,4,1,2,0,5,7,4,9,3,0,8,3,6,8,4,1,4,5,4,5,2,5,0,7,8,8,4,9,7,5,9,6,8,0,0,9,5,4,1,4,5,6,3,9,0,9,4,8,0,7,0,4,2,1,7,8,9,1,7,4,2,4,4,3,6,3,6,3,5,2,2,2,3,0,0,2,1,0,5,8,5,8,6,1,0,0,2,0,1,1,5,5,7,3,7,9,5,7,7,6,6,5,4,8,2,4,3,5,1,3,6,7,9,0,7,1,1,9,6,1,0,6,5,9,2,7,8,9,5,9,0,8,0,0,8,5,7,7,0,4,7,6,5,5,1,8,1,1,8,9,6,7,3,1,6,7,9,7,3,9,6,7,9,6,7,3,6,8,8,1,6,0,4,1,1,3,7,9,8,1,8,0,0,9,1,1,2,0,9,4,6,6,6,8,7,7,8,5,0 }, 615, false);
-            BigNumber ln18_tmp = ln18;
-            ln18_tmp.Mul(counter8, BIGNUMBER_PRECISION_PADDED(precision));
-            result.Sub(ln18_tmp);
+            const size_t decimals = *it + digits;
+
+            // y = y + 2 * (x - e^y) / (x + e^y)
+            const BigNumber ey = BigNumber(result).Exp(decimals);
+            BigNumber numerator = BigNumber(*this).Sub(ey);
+            numerator.Mul(_number_two, decimals);
+            const BigNumber denominator = BigNumber(*this).Add(ey);
+            result.Add(numerator.Div(denominator, decimals));
         }
 
         // done
@@ -2570,11 +4741,14 @@ namespace MyOddWeb
      * 'Normalize' the angle given an make sure that it falls within 0-2*pi
      * This is used to make the calculations more accurate and faster.
      * @param const BigNumber& radian the radian we want to make sure is in range.
+     * @param size_t precision the precision we will be using the angle with.
      * @return BigNumber the recalculated radian.
      */
-    BigNumber BigNumber::_NormalizeAngle(const BigNumber& radian)
+    BigNumber BigNumber::_NormalizeAngle(const BigNumber& radian, size_t precision)
     {
-        static const BigNumber twoPi = BigNumber(BigNumber::pi()).Mul(_number_two);
+        // the bigger the angle the more decimals of pi we lose.
+        const size_t decimals = BIGNUMBER_PRECISION_PADDED(precision) + radian._limbs.size() * BIGNUMBER_LIMB_DIGITS;
+        const BigNumber& twoPi = _GetConstant(_two_pi_constant, decimals, &BigNumber::_CalculateTwoPi);
         BigNumber result = radian;
         if (BigNumber::AbsCompare(result, twoPi) == 1)
         {
@@ -2602,7 +4776,7 @@ namespace MyOddWeb
         //                (x ^ 3)   (x ^ 5)   (x ^ 7)
         // sin(x) = (x) - ------- + ------- - ------- ...
         //                  3!       5!         7!
-        BigNumber result = BigNumber::_NormalizeAngle(*this);
+        BigNumber result = BigNumber::_NormalizeAngle(*this, precision);
         const BigNumber multiplier = BigNumber(result).Pow(2, BIGNUMBER_PRECISION_PADDED(precision));
         BigNumber startingMultiplier = result;
         BigNumber startingFractional = _number_one;
@@ -2657,7 +4831,7 @@ namespace MyOddWeb
         // sin(x) = (1) - ------- + ------- - ------- ...
         //                  2!       4!         6!
         BigNumber result = _number_one;
-        const BigNumber multiplier = BigNumber::_NormalizeAngle(*this).Pow(2, BIGNUMBER_PRECISION_PADDED(precision));
+        const BigNumber multiplier = BigNumber::_NormalizeAngle(*this, precision).Pow(2, BIGNUMBER_PRECISION_PADDED(precision));
         BigNumber startingMultiplier = _number_one;
         BigNumber startingFractional = _number_one;
         BigNumber fractionalCounter = _number_zero;
@@ -2738,7 +4912,7 @@ namespace MyOddWeb
         }
 
         // get 180 / pi
-        BigNumber oneEightyOverpi = BigNumber::AbsDiv(180, BigNumber::pi(), BIGNUMBER_PRECISION_PADDED(precision));
+        BigNumber oneEightyOverpi = BigNumber::AbsDiv(180, BigNumber::pi(BIGNUMBER_PRECISION_PADDED(BIGNUMBER_PRECISION_PADDED(precision))), BIGNUMBER_PRECISION_PADDED(precision));
 
         // the number is x * (180/pi)
         Mul(oneEightyOverpi, BIGNUMBER_PRECISION_PADDED(precision));
@@ -2762,7 +4936,7 @@ namespace MyOddWeb
         }
 
         // get pi / 180
-        BigNumber piOver180 = BigNumber::AbsDiv(BigNumber::pi(), 180, BIGNUMBER_PRECISION_PADDED(precision));
+        BigNumber piOver180 = BigNumber::AbsDiv(BigNumber::pi(BIGNUMBER_PRECISION_PADDED(BIGNUMBER_PRECISION_PADDED(precision))), 180, BIGNUMBER_PRECISION_PADDED(precision));
 
         // the number is x * (pi/180)
         Mul(piOver180, BIGNUMBER_PRECISION_PADDED(precision));
@@ -2771,4 +4945,345 @@ namespace MyOddWeb
         return Round(precision).PerformPostOperations(precision);
     }
 
-}// namespace MyOddWeb
\ No newline at end of file
+    /**
+     * The default constructor, zero.
+     */
+    BigInt::BigInt()
+    {
+    }
+
+    /**
+     * Construct a whole number from a string, "1234".
+     * @throw std::runtime_error if the value is not a whole number greater or equal to zero.
+     * @param const char* source the string we would like to use as a number.
+     */
+    BigInt::BigInt(const char* source)
+    {
+        Parse(source);
+    }
+
+    /**
+     * Construct a whole number from a 64 bit number.
+     * @param unsigned long long source the number we want.
+     */
+    BigInt::BigInt(unsigned long long source)
+    {
+        BigNumber::_ULongLongToLimbs(source, _limbs);
+    }
+
+    /**
+     * Construct a whole number from an int.
+     * @throw std::runtime_error if the number is negative.
+     * @param int source the number we want.
+     */
+    BigInt::BigInt(int source)
+    {
+        if (source < 0)
+        {
+            throw std::runtime_error("The given value is not a whole number greater or equal to zero.");
+        }
+        BigNumber::_ULongLongToLimbs((unsigned long long)source, _limbs);
+    }
+
+    /**
+     * Construct a whole number from a BigNumber, "12.000" is 12.
+     * @throw std::runtime_error if the number is NaN, negative or has decimals.
+     * @param const BigNumber& source the number we want.
+     */
+    BigInt::BigInt(const BigNumber& source)
+    {
+        if (!source.IsInteger() || source.IsNeg())
+        {
+            throw std::runtime_error("The given value is not a whole number greater or equal to zero.");
+        }
+        _limbs = source._limbs;
+    }
+
+    /**
+     * Parse a string of numbers, the spaces and a leading '+' are ignored.
+     * @throw std::runtime_error if the value is invalid.
+     * @param const char* source the string we would like to use as a number.
+     */
+    void BigInt::Parse(const char* source)
+    {
+        // sanity check
+        if (NULL == source)
+        {
+            throw std::runtime_error("The given value is not a valid string.");
+        }
+
+        // the numbers, the biggest number first, without the spaces.
+        const size_t length = strlen(source);
+        char buffer[64];
+        std::unique_ptr<char[]> allocated;
+        char* numbers = buffer;
+        if (length + 1 > sizeof(buffer))
+        {
+            allocated.reset(new char[length + 1]);
+            numbers = allocated.get();
+        }
+        size_t count = 0;
+
+        bool allowSign = true;
+        const char* c = source;
+        const char* end = source + length;
+        while (c < end)
+        {
+            const size_t run = BigNumber::_DigitsRun(c, end - c);
+            if (run > 0)
+            {
+                std::memcpy(numbers + count, c, run);
+                count += run;
+                c += run;
+                allowSign = false;
+                continue;
+            }
+
+            if (*c == ' ' || (*c == '+' && allowSign))
+            {
+                allowSign = allowSign && *c == ' ';
+                c++;
+                continue;
+            }
+
+            // a '-', a '.' or anything else.
+            throw std::runtime_error("The given value is not a whole number greater or equal to zero.");
+        }
+
+        // pack the numbers in limbs and remove the leading zeros.
+        BigNumber::_DigitsToLimbs(numbers, count, _limbs);
+        while (!_limbs.empty() && _limbs.back() == 0)
+        {
+            _limbs.pop_back();
+        }
+    }
+
+    /**
+     * Add a number to this one, this += rhs
+     * @param const BigInt& rhs the number we are adding.
+     * @return BigInt& *this the sum.
+     */
+    BigInt& BigInt::Add(const BigInt& rhs)
+    {
+        BigNumber::_AddLimbsAssign(_limbs, rhs._limbs);
+        return *this;
+    }
+
+    /**
+     * Subtract a number from this one, this -= rhs
+     * @throw std::runtime_error if rhs is greater than this number, (the result would be negative).
+     * @param const BigInt& rhs the number we are subtracting.
+     * @return BigInt& *this the difference.
+     */
+    BigInt& BigInt::Sub(const BigInt& rhs)
+    {
+        if (BigNumber::_CompareLimbs(_limbs, rhs._limbs) < 0)
+        {
+            throw std::runtime_error("A whole number cannot be subtracted from a smaller one.");
+        }
+        BigNumber::_SubLimbsAssign(_limbs, rhs._limbs);
+        return *this;
+    }
+
+    /**
+     * Multiply this number by another one, this *= rhs
+     * @param const BigInt& rhs the number we are multiplying by.
+     * @return BigInt& *this the product.
+     */
+    BigInt& BigInt::Mul(const BigInt& rhs)
+    {
+        BigNumber::LIMBS product;
+        BigNumber::_MulLimbs(_limbs, rhs._limbs, product);
+        _limbs = std::move(product);
+        return *this;
+    }
+
+    /**
+     * The whole number of times the denominator goes in this number, 7 / 2 = 3
+     * @throw std::runtime_error if the denominator is zero.
+     * @param const BigInt& denominator the number dividing.
+     * @return BigInt the quotient.
+     */
+    BigInt BigInt::Quotient(const BigInt& denominator) const
+    {
+        BigInt quotient, remainder;
+        DivMod(denominator, quotient, remainder);
+        return quotient;
+    }
+
+    /**
+     * What is left once the denominator is taken out of this number as many times as we can, 7 % 2 = 1
+     * @throw std::runtime_error if the denominator is zero.
+     * @param const BigInt& denominator the number dividing.
+     * @return BigInt the remainder.
+     */
+    BigInt BigInt::Mod(const BigInt& denominator) const
+    {
+        BigInt quotient, remainder;
+        DivMod(denominator, quotient, remainder);
+        return remainder;
+    }
+
+    /**
+     * The quotient and the remainder of this number divided by the denominator, in one division.
+     * @throw std::runtime_error if the denominator is zero.
+     * @param const BigInt& denominator the number dividing.
+     * @param BigInt& quotient the whole number of times the denominator goes in this number.
+     * @param BigInt& remainder what is left.
+     */
+    void BigInt::DivMod(const BigInt& denominator, BigInt& quotient, BigInt& remainder) const
+    {
+        if (denominator.IsZero())
+        {
+            throw std::runtime_error("Division by zero");
+        }
+
+        // the quotient and the remainder cannot be the limbs we are dividing.
+        BigNumber::LIMBS q, r;
+        BigNumber::_DivModLimbs(_limbs, denominator._limbs, q, &r);
+        quotient._limbs = std::move(q);
+        remainder._limbs = std::move(r);
+    }
+
+    /**
+     * Compare this number to another one.
+     * @param const BigInt& rhs the number we are comparing to.
+     * @return int -ve rhs is greater, +ve this is greater and 0 = they are equal.
+     */
+    int BigInt::Compare(const BigInt& rhs) const
+    {
+        return BigNumber::_CompareLimbs(_limbs, rhs._limbs);
+    }
+
+    bool BigInt::IsZero() const
+    {
+        return _limbs.empty();
+    }
+
+    bool BigInt::IsOdd() const
+    {
+        return !_limbs.empty() && (_limbs[0] & 1) == 1;
+    }
+
+    bool BigInt::IsEven() const
+    {
+        return !IsOdd();
+    }
+
+    bool BigInt::IsEqual(const BigInt& rhs) const
+    {
+        return Compare(rhs) == 0;
+    }
+
+    bool BigInt::IsUnequal(const BigInt& rhs) const
+    {
+        return Compare(rhs) != 0;
+    }
+
+    bool BigInt::IsGreater(const BigInt& rhs) const
+    {
+        return Compare(rhs) > 0;
+    }
+
+    bool BigInt::IsLess(const BigInt& rhs) const
+    {
+        return Compare(rhs) < 0;
+    }
+
+    bool BigInt::IsGreaterEqual(const BigInt& rhs) const
+    {
+        return Compare(rhs) >= 0;
+    }
+
+    bool BigInt::IsLessEqual(const BigInt& rhs) const
+    {
+        return Compare(rhs) <= 0;
+    }
+
+    /**
+     * Convert the number to a 64 bit number.
+     * @throw std::runtime_error if the number is too big.
+     * @return unsigned long long the number.
+     */
+    unsigned long long BigInt::ToULongLong() const
+    {
+        unsigned long long number = 0;
+        for (size_t i = _limbs.size(); i > 0; --i)
+        {
+            if (number > (std::numeric_limits<unsigned long long>::max() - _limbs[i - 1]) / BIGNUMBER_LIMB_BASE)
+            {
+                throw std::runtime_error("The number is too big for an unsigned long long.");
+            }
+            number = number * BIGNUMBER_LIMB_BASE + _limbs[i - 1];
+        }
+        return number;
+    }
+
+    /**
+     * The number of characters ToString() would give us, (without the '\0').
+     * @return size_t the length of the number as a string.
+     */
+    size_t BigInt::ToStringLength() const
+    {
+        return _limbs.empty() ? 1 : BigNumber::_LimbsDigits(_limbs);
+    }
+
+    /**
+     * Write the number, the same as ToString(), in a buffer we do not own, nothing is allocated.
+     * The buffer must have room for ToStringLength() characters, no '\0' is added.
+     * @param char* buffer where we are writing the number.
+     * @return char* the character after the last one we wrote.
+     */
+    char* BigInt::AppendTo(char* buffer) const
+    {
+        const size_t length = ToStringLength();
+        BigNumber::_WriteLimbs(_limbs, length, buffer + length);
+        return buffer + length;
+    }
+
+    /**
+     * Write the number, the same as ToString(), in a buffer of a given size, with a '\0' at the end.
+     * If the buffer is too small, nothing is written, (other than a '\0' if there is room for it).
+     * @param char* buffer where we are writing the number.
+     * @param size_t size the number of characters we can write, including the '\0'.
+     * @return size_t the length of the number, (without the '\0'), even if it was not written.
+     */
+    size_t BigInt::WriteDigits(char* buffer, size_t size) const
+    {
+        const size_t length = ToStringLength();
+        if (buffer == NULL || size == 0)
+        {
+            return length;
+        }
+        if (size <= length)
+        {
+            *buffer = '\0';
+            return length;
+        }
+        *AppendTo(buffer) = '\0';
+        return length;
+    }
+
+    /**
+     * Convert the number to a string, "1234".
+     * @return std::string the number.
+     */
+    std::string BigInt::ToString() const
+    {
+        std::string number(ToStringLength(), '0');
+        AppendTo(&number[0]);
+        return number;
+    }
+
+    /**
+     * Convert the number to a BigNumber.
+     * @return BigNumber the same number.
+     */
+    BigNumber BigInt::ToBigNumber() const
+    {
+        BigNumber number;
+        number._limbs = _limbs;
+        return number.PerformPostOperations(0);
+    }
+
+}// namespace MyOddWeb
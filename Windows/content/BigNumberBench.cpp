@@ -0,0 +1,91 @@
+// Times BigNumber multiplications and divisions of random operands, to check the
+// BIGNUMBER_KARATSUBA_LIMBS, BIGNUMBER_TOOM3_LIMBS and BIGNUMBER_NEWTON_LIMBS crossovers.
+// It is not part of content, build it on its own, (with the same optimisation as content):
+//
+//   g++ -O2 BigNumberBench.cpp BigNumber.cpp -o bench
+//
+// every build times what the thresholds pick, so to time one side of a crossover build it again with other values:
+//
+//   long multiplication : -DBIGNUMBER_KARATSUBA_LIMBS='((size_t)-1)' -DBIGNUMBER_TOOM3_LIMBS='((size_t)-1)'
+//   no Toom-3           : -DBIGNUMBER_TOOM3_LIMBS='((size_t)-1)'
+//   Toom-3 from 40 limbs: -DBIGNUMBER_TOOM3_LIMBS='((size_t)40)'
+//   Knuth division only : -DBIGNUMBER_NEWTON_LIMBS='((size_t)-1)'
+//   Newton from 16 limbs: -DBIGNUMBER_NEWTON_LIMBS='((size_t)16)', (not less than 8, @see BIGNUMBER_NEWTON_LIMBS)
+//
+// (with cl.exe: cl /O2 /EHsc /DBIGNUMBER_NEWTON_LIMBS=((size_t)-1) BigNumberBench.cpp BigNumber.cpp)
+// the crossover is the size where the faster of the two builds changes.
+#include "BigNumber.h"
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <random>
+#include <chrono>
+
+using namespace std;
+using namespace MyOddWeb;
+
+// a random whole number of that many limbs, (the first digit is never 0).
+static string RandomDigits(size_t limbs, mt19937& random)
+{
+    uniform_int_distribution<int> digit(0, 9);
+    string digits(limbs * BIGNUMBER_LIMB_DIGITS, '0');
+    for (size_t i = 0; i < digits.size(); ++i)
+    {
+        digits[i] = static_cast<char>('0' + digit(random));
+    }
+    digits[0] = static_cast<char>('1' + digit(random) % 9);
+    return digits;
+}
+
+// the milliseconds one call of work takes, it is repeated for at least a quarter of a second.
+template<class WORK>
+static double Time(WORK work)
+{
+    typedef chrono::steady_clock clock;
+    const clock::time_point start = clock::now();
+    size_t count = 0;
+    double elapsed = 0;
+    do
+    {
+        work();
+        ++count;
+        elapsed = chrono::duration<double, milli>(clock::now() - start).count();
+    } while (elapsed < 250 || count < 3);
+    return elapsed / count;
+}
+
+int main()
+{
+    mt19937 random(12345);
+
+    cout << "BIGNUMBER_KARATSUBA_LIMBS " << BIGNUMBER_KARATSUBA_LIMBS
+         << ", BIGNUMBER_TOOM3_LIMBS " << BIGNUMBER_TOOM3_LIMBS
+         << ", BIGNUMBER_NEWTON_LIMBS " << BIGNUMBER_NEWTON_LIMBS
+         << " (" << BIGNUMBER_LIMB_DIGITS << " digits a limb)\n\n";
+
+    // both operands the same size, (the algorithm is picked from the smallest one).
+    const size_t products[] = { 10, 20, 30, 40, 60, 80, 150, 200, 300, 450, 600, 1000, 2000, 4000 };
+    cout << "multiplication   ms\n";
+    for (size_t i = 0; i < sizeof(products) / sizeof(products[0]); ++i)
+    {
+        const BigNumber lhs(RandomDigits(products[i], random).c_str());
+        const BigNumber rhs(RandomDigits(products[i], random).c_str());
+        const double ms = Time([&]() { BigNumber(lhs).Mul(rhs, 0); });
+        cout << setw(7) << products[i] << " limbs   " << fixed << setprecision(4) << ms << "\n";
+    }
+
+    // whole numbers, so the quotient has as many limbs as the numerator has more than the denominator.
+    const size_t divisions[] = { 50, 100, 150, 200, 300, 450, 500, 1000, 2000, 4000 };
+    cout << "\ndivision         ms, quotient as long   ms, quotient a quarter\n";
+    for (size_t i = 0; i < sizeof(divisions) / sizeof(divisions[0]); ++i)
+    {
+        const size_t limbs = divisions[i];
+        const BigNumber denominator(RandomDigits(limbs, random).c_str());
+        const BigNumber full(RandomDigits(limbs * 2, random).c_str());
+        const BigNumber quarter(RandomDigits(limbs + limbs / 4, random).c_str());
+        const double fullMs = Time([&]() { BigNumber(full).Div(denominator, 0); });
+        const double quarterMs = Time([&]() { BigNumber(quarter).Div(denominator, 0); });
+        cout << setw(7) << limbs << " limbs   " << fixed << setprecision(4) << setw(10) << fullMs << "             " << setw(10) << quarterMs << "\n";
+    }
+    return 0;
+}
@@ -1,155 +1,654 @@
 #include"BigNumber.h"
 #include<iostream>
 #include<fstream>
+#include<string>
+#include<sstream>
+#include<vector>
+#include<thread>
+#include<atomic>
+#include<cstring>
+#include<windows.h>
 
 using namespace std;
 using namespace MyOddWeb;
 
-ofstream ux("content.txt");
+// collects the rows in one big block of memory and writes it to the file
+// a block at a time, rather than one stream insertion per piece of a row.
+// without a file it only keeps growing, (a worker's private shard).
+class Buffer
+{
+private:
+    string name, data;
+    size_t capacity = 0, written = 0;
+    bool failed = false;
+
+    // the file is opened once, the rows written and the part that is mapped always go to the same file.
+    // the part of the file that is mapped, from offset, (a multiple of the allocation granularity), to length.
+    HANDLE handle = INVALID_HANDLE_VALUE, mapping = NULL;
+    char* mapped = nullptr;
+    size_t offset = 0, length = 0;
+
+    void Write(const char*, size_t);
+
+public:
+    Buffer(void);
+    Buffer(const char*, size_t);
+
+    bool IsOpen(void) const;
+    void Append(const char*, size_t);
+    void Append(const string&);
+    void Take(Buffer&);
+    size_t Size(void) const;
+    void CopyTo(char*);
+    char* Map(size_t);
+    void Unmap(void);
+    void Flush(void);
+    bool Close(void);
+};
+
+// a chapter number kept as decimal text, counting up one at a time.
+// the digits are right aligned in a buffer as long as the last chapter so
+// a carry into a new digit never moves the others.
+class Counter
+{
+private:
+    string digits, last;
+    size_t first, changed, same;
+
+public:
+    Counter(const string&, const string&);
+
+    void PlusOne(void);
+    bool IsLast(void) const;
+    size_t Changed(void) const;
+    size_t Size(void) const;
+    const char* Data(void) const;
+    char Back(void) const;
+};
 
 class control
 {
 private:
     int digits = 0;
-    int* table = new int[20];
+    static const int table[20];
+    static const size_t MaxDigits = 77;
+    static const string numerals[10];
+    static const string units[4];
+    static const string groups[20];
+    static const string row[5];
+    static const int ShardRows = 16384;
+    static const unsigned int MappedJobs = 8;
     bool fake = false, ten = true;
-    BigNumber begin, end;
+    BigInt begin, end;
+    unsigned int jobs = 1;
+
+    // where the rows go, the output file or the shard of a worker.
+    // place is where the shard goes in the mapped file.
+    Buffer* out = nullptr;
+    Buffer shard;
+    char* place = nullptr;
+
+    // the chapter number read from the units up, (what used to be the BigNumber "reversal").
+    // only the digits in [low, high) are still part of the number.
+    string reversal, label;
+    size_t low = 0, high = 0;
 
-    void NumberConv(BigNumber);
+    // where every pass of NumberConv started, so the next chapter can start
+    // again from the first pass that looked at one of the digits that changed.
+    struct Step
+    {
+        size_t size, low, high, touched;
+        int digits;
+        bool key, ten;
+        char NextNumber, SecNumber;
+    };
+    vector<Step> steps;
+    size_t touched = 0;
+
+    void Rows(void);
+    void Place(void);
+    void Parallel(void);
+    bool Mapped(void);
+    void Spread(vector<control>&, void (control::*)(void));
+    void NumberConv(const Counter&);
     bool NumberToChinese(int, bool);
     int DigitsConv(bool);
 
+    int Last(void);
+    char PointAt(int);
+    void Keep(size_t);
+    void Drop(size_t);
+
+    bool Write(const string&, string&);
+
 public:
     void UserInput(void);
+    bool Generate(const string&, const string&, const string&, unsigned int, string&);
+};
+
+// what to do for one range, from the command line or from one line of a batch file.
+struct Job
+{
+    string begin, end, output = "content.txt", batch;
+    unsigned int jobs = 0;
+};
+
+bool ReadArguments(const vector<string>&, Job&, string&);
+int RunBatch(const Job&);
+
+const int control::table[20] = {1, 5, 9, 13, 17, 21, 25, 29, 33, 37, 41, 45, 49, 53, 57, 61, 65, 69, 73, 77};
+const string control::numerals[10] = {"零", "一", "二", "三", "四", "五", "六", "七", "八", "九"};
+const string control::units[4] = {"", "十", "百", "千"};
+const string control::groups[20] = {"", "萬", "億", "兆", "京", "垓", "秭", "穰", "溝", "澗", "正", "戴", "極", "恆河沙", "阿僧祇", "那由他", "不可思議", "無量", "大數", ""};
+
+// the fixed parts of a row, the chapter number and its Chinese name go in between.
+// the file is written in binary, so the lines end with \r\n like the ones of a Windows text file.
+const string control::row[5] =
+{
+    "      <tr>\r\n        <td class=\"mbt05 w40 tdtop\"><a class=\"nodeco color1\" href=\"../Text/chapter0.xhtml\">序章</a></td>\r\n\r\n        <td class=\"mbt05 left\"><a class=\"nodeco color1\" href=\"../Text/chapter0.xhtml\">(章節標題)</a></td>\r\n      </tr>\r\n",
+    "      <tr>\r\n        <td class=\"mbt05 w40 tdtop\"><a class=\"nodeco color1\" href=\"../Text/chapter",
+    ".xhtml\">第",
+    "章</a></td>\r\n\r\n        <td class=\"mbt05 left\"><a class=\"nodeco color1\" href=\"../Text/chapter",
+    ".xhtml\">(章節標題)</a></td>\r\n      </tr>\r\n"
 };
 
-int main()
+const char* const usage =
+    "Usage: content.exe --begin N --end N [--output FILE] [--jobs N]\n"
+    "       content.exe --batch FILE [--jobs N]\n"
+    "Without arguments the chapters are asked for and the rows go to content.txt.\n"
+    "A batch file has the options of one range per line, (--begin, --end, --output and --jobs),\n"
+    "empty lines and lines starting with # are skipped, the ranges run --jobs at a time.\n";
+
+int main(int argc, char* argv[])
 {
+    if (argc == 1)
+    {
+        control user;
+        user.UserInput();
+        return 0;
+    }
+
+    Job job;
+    string error;
+    if (!ReadArguments(vector<string>(argv + 1, argv + argc), job, error))
+    {
+        if (error.empty())
+        {
+            cout << usage;
+            return 0;
+        }
+        cerr << "Error! " << error << "\n\n" << usage;
+        return 2;
+    }
+    if (!job.batch.empty()) return RunBatch(job);
+
     control user;
-    user.UserInput();
-    ux.close();
+    if (!user.Generate(job.begin, job.end, job.output, job.jobs, error))
+    {
+        cerr << "Error! " << error << "\n";
+        return 1;
+    }
     return 0;
 }
 
+// read --name value, (or --name=value), pairs.
+bool ReadArguments(const vector<string>& arguments, Job& job, string& error)
+{
+    for (size_t a = 0; arguments.size() > a; a++)
+    {
+        string name = arguments[a], value;
+        size_t equal = name.find('=');
+        if (equal != string::npos)
+        {
+            value = name.substr(equal + 1);
+            name.erase(equal);
+        }
+        else if (name == "--help" || name == "-h")
+        {
+            error = "";
+            return false;
+        }
+        else if (arguments.size() > a + 1) value = arguments[++a];
+        else
+        {
+            error = name + " needs a value.";
+            return false;
+        }
+
+        if (name == "--begin") job.begin = value;
+        else if (name == "--end") job.end = value;
+        else if (name == "--output") job.output = value;
+        else if (name == "--batch") job.batch = value;
+        else if (name == "--jobs")
+        {
+            if (value.empty() || value.find_first_not_of("0123456789") != string::npos || value.size() > 4)
+            {
+                error = "--jobs needs a number of workers.";
+                return false;
+            }
+            job.jobs = stoi(value);
+        }
+        else
+        {
+            error = "Unknown option " + name + ".";
+            return false;
+        }
+    }
+
+    if (job.batch.empty() && (job.begin.empty() || job.end.empty()))
+    {
+        error = "--begin and --end are both needed.";
+        return false;
+    }
+    return true;
+}
+
+// run every range of the batch file, --jobs ranges at a time, (each range uses its own --jobs, 1 by default).
+int RunBatch(const Job& settings)
+{
+    ifstream manifest(settings.batch);
+    if (!manifest.is_open())
+    {
+        cerr << "Error! Cannot open " << settings.batch << ".\n";
+        return 1;
+    }
+
+    vector<Job> jobs;
+    vector<size_t> lines;
+    string line, error;
+    int failed = 0;
+    for (size_t number = 1; getline(manifest, line); number++)
+    {
+        if (!line.empty() && line[line.size() - 1] == '\r') line.erase(line.size() - 1);
+
+        vector<string> arguments;
+        istringstream words(line);
+        for (string word; words >> word;) arguments.push_back(word);
+        if (arguments.empty() || arguments[0][0] == '#') continue;
+
+        Job job;
+        job.jobs = 1;
+        if (!ReadArguments(arguments, job, error) || !job.batch.empty())
+        {
+            cerr << settings.batch << ":" << number << ": Error! " << (job.batch.empty() ? error : "a batch cannot run another batch.") << "\n";
+            failed = 1;
+            continue;
+        }
+
+        // two ranges writing the same file at the same time would mix their rows.
+        size_t same = 0;
+        while (jobs.size() > same && jobs[same].output != job.output) same++;
+        if (jobs.size() > same)
+        {
+            cerr << settings.batch << ":" << number << ": Error! " << job.output << " is already written by line " << lines[same] << ".\n";
+            failed = 1;
+            continue;
+        }
+        jobs.push_back(job);
+        lines.push_back(number);
+    }
+
+    unsigned int workers = settings.jobs ? settings.jobs : thread::hardware_concurrency();
+    if (workers == 0) workers = 1;
+
+    atomic<size_t> next(0);
+    atomic<int> result(failed);
+    vector<thread> running;
+    for (unsigned int a = 0; workers > a; a++)
+    {
+        running.push_back(thread([&]()
+        {
+            for (size_t b = next++; jobs.size() > b; b = next++)
+            {
+                string reason;
+                control user;
+                if (!user.Generate(jobs[b].begin, jobs[b].end, jobs[b].output, jobs[b].jobs, reason))
+                {
+                    string message = settings.batch + ":" + to_string(lines[b]) + ": Error! " + reason + "\n";
+                    cerr << message;
+                    result = 1;
+                }
+            }
+        }));
+    }
+    for (unsigned int a = 0; workers > a; a++) running[a].join();
+    return result;
+}
+
 void control::UserInput(void)
 {
-    char space[200];
+    string space;
     cout << "Please enter the beginning chapter: ";
     cin >> space;
-    this->begin = space;
-    while (this->begin.IsLess(0))
+    BigNumber first = space.c_str();
+    while (first.IsLess(0) || !first.IsInteger() || first.ToString().size() > control::MaxDigits)
     {
-        cout << "Error! Please enter a number greater than 0.\n\nPlease enter the beginning chapter: ";
+        cout << "Error! Please enter a number greater than 0, (at most " << control::MaxDigits << " digits).\n\nPlease enter the beginning chapter: ";
         cin >> space;
-        this->begin = space;
+        first = space.c_str();
     }
-    cout << "Please enter the ending chapter(>= " << this->begin.ToString() << "): ";
+    cout << "Please enter the ending chapter(>= " << first.ToString() << "): ";
     cin >> space;
-    this->end = space;
-    while (this->begin.IsGreater(this->end))
+    BigNumber last = space.c_str();
+    while (first.IsGreater(last) || !last.IsInteger() || last.ToString().size() > control::MaxDigits)
     {
-        cout << "Error! Please enter a number greater " << this->begin.ToString() << ".\n\n";
-        cout << "Please enter the beginning chapter(>= " << this->begin.ToString() << "): ";
+        cout << "Error! Please enter a number greater " << first.ToString() << ", (at most " << control::MaxDigits << " digits).\n\n";
+        cout << "Please enter the beginning chapter(>= " << first.ToString() << "): ";
         cin >> space;
-        this->end = space;
+        last = space.c_str();
+    }
+
+    // from here on they are only counted, they do not need the decimals or the sign.
+    this->begin = BigInt(first);
+    this->end = BigInt(last);
+
+    string error;
+    this->jobs = thread::hardware_concurrency();
+    if (!this->Write("content.txt", error)) cout << "Error! " << error << "\n";
+}
+
+// check the range, then write its rows in the given file with that many workers, (0 for one per core).
+// false with the reason if the range cannot be used or the file cannot be written.
+bool control::Generate(const string& first, const string& last, const string& filename, unsigned int workers, string& error)
+{
+    BigNumber from, to;
+    try
+    {
+        from = first.c_str();
+        to = last.c_str();
+    }
+    catch (const runtime_error&)
+    {
+        error = "The chapters have to be numbers.";
+        return false;
+    }
+    if (!from.IsInteger() || !to.IsInteger() || from.IsLess(0))
+    {
+        error = "The chapters have to be whole numbers greater than 0.";
+        return false;
+    }
+    if (from.IsGreater(to))
+    {
+        error = "The ending chapter has to be greater than " + from.ToString() + ".";
+        return false;
+    }
+    if (to.ToString().size() > control::MaxDigits)
+    {
+        error = "The chapters can have at most " + to_string(control::MaxDigits) + " digits.";
+        return false;
+    }
+    this->begin = BigInt(from);
+    this->end = BigInt(to);
+
+    this->jobs = workers ? workers : thread::hardware_concurrency();
+    return this->Write(filename, error);
+}
+
+bool control::Write(const string& filename, string& error)
+{
+    Buffer file(filename.c_str(), 1 << 20);
+    if (!file.IsOpen())
+    {
+        error = "Cannot open " + filename + ".";
+        return false;
     }
-    for (int a = 0, b = 1; 20 > a; a++, b += 4) this->table[a] = b;
 
+    this->out = &file;
     if (this->begin.IsEqual(0))
     {
-        ux << "      <tr>\n        <td class=\"mbt05 w40 tdtop\"><a class=\"nodeco color1\" href=\"../Text/chapter0.xhtml\">序章</a></td>\n\n        <td class=\"mbt05 left\"><a class=\"nodeco color1\" href=\"../Text/chapter0.xhtml\">(章節標題)</a></td>\n      </tr>\n";
+        this->out->Append(this->row[0]);
         this->begin = 1;
     }
-   for (; this->end.IsGreaterEqual(this->begin); this->begin.Add(1))
-   {
-       cout << this->begin.ToString() << "\n";
-       this->fake = false;
-       ux << "      <tr>\n        <td class=\"mbt05 w40 tdtop\"><a class=\"nodeco color1\" href=\"../Text/chapter" << this->begin.ToString() << ".xhtml\">第";
-       if (this->begin.Mod(10).ToInt() == 0)
-       {
-               this->begin.Add(1);
-               this->fake = true;
-       }
-       this->NumberConv(this->begin);
-       if (fake) this->begin.Sub(1);
-       ux << "章</a></td>\n\n        <td class=\"mbt05 left\"><a class=\"nodeco color1\" href=\"../Text/chapter" << this->begin.ToString() << ".xhtml\">(章節標題)</a></td>\n      </tr>\n";
-   }
-}
-
-void control::NumberConv(BigNumber now)
-{
-    int point, check;
-    this->digits = 0;
+
+    // one worker, (or less than a shard), gains nothing from cutting the range in shards,
+    // the rows go straight through the stream.
+    // otherwise Parallel() hands the shards to the stream in order while the workers write the next ones.
+    // one thread writing the stream, (about 1.5GB/s), is slower than the workers once there are more
+    // than about 4 of them, (about 1GB/s each), so with MappedJobs workers, (and as many cores),
+    // the workers copy their shards in the mapped file themselves, (about 0.6GB/s each).
+    // if the file cannot be mapped, (a pipe...), Mapped() stops and Parallel() writes the rest.
+    if (this->jobs == 0) this->jobs = 1;
+    if (this->jobs == 1 || this->end.IsLess(BigInt(this->begin).Add(control::ShardRows))) this->Rows();
+    else if (this->jobs < control::MappedJobs || thread::hardware_concurrency() < control::MappedJobs || !this->Mapped()) this->Parallel();
+
+    this->out = nullptr;
+    if (!file.Close())
+    {
+        error = "Cannot write " + filename + ".";
+        return false;
+    }
+    return true;
+}
+
+// write the rows from begin to end, (both included).
+void control::Rows(void)
+{
+    if (this->begin.IsGreater(this->end)) return;
+
+    Counter chapter(this->begin.ToString(), this->end.ToString());
+    for (;; chapter.PlusOne())
+    {
+        // a chapter ending with 0 is written as the next chapter, (...1), and cut short.
+        this->fake = (chapter.Back() == '0');
+        this->NumberConv(chapter);
+
+        this->out->Append(this->row[1]);
+        this->out->Append(chapter.Data(), chapter.Size());
+        this->out->Append(this->row[2]);
+        this->out->Append(this->label);
+        this->out->Append(this->row[3]);
+        this->out->Append(chapter.Data(), chapter.Size());
+        this->out->Append(this->row[4]);
+        if (chapter.IsLast()) break;
+    }
+}
+
+// copy the rows of the shard at their place in the mapped file.
+void control::Place(void)
+{
+    this->shard.CopyTo(this->place);
+}
+
+// the range is written a round at a time, every worker writes up to ShardRows chapters in its own shard,
+// the file is then grown by the size of all the shards of the round, that part of the file is mapped
+// and every worker copies its shard at its own offset, so every row is only converted once.
+// false if the file cannot be mapped, the shards of that round were handed to the stream then
+// and begin is the first chapter that is still to be written.
+bool control::Mapped(void)
+{
+    vector<control> workers(this->jobs);
+    while (this->end.IsGreaterEqual(this->begin))
+    {
+        unsigned int count = 0;
+        for (; this->jobs > count && this->end.IsGreaterEqual(this->begin); count++)
+        {
+            control& worker = workers[count];
+            worker.out = &worker.shard;
+            worker.begin = this->begin;
+            worker.end = BigInt(this->begin).Add(control::ShardRows - 1);
+            if (worker.end.IsGreater(this->end)) worker.end = this->end;
+            this->begin = BigInt(worker.end).Add(1);
+        }
+        if (workers.size() > count) workers.resize(count);
+        this->Spread(workers, &control::Rows);
+
+        size_t total = 0;
+        for (unsigned int a = 0; count > a; a++) total += workers[a].shard.Size();
+
+        char* memory = this->out->Map(total);
+        if (memory == nullptr)
+        {
+            for (unsigned int a = 0; count > a; a++) this->out->Take(workers[a].shard);
+            return false;
+        }
+        for (unsigned int a = 0; count > a; a++)
+        {
+            workers[a].place = memory;
+            memory += workers[a].shard.Size();
+        }
+        this->Spread(workers, &control::Place);
+        this->out->Unmap();
+    }
+    return true;
+}
+
+// run the work of every worker, spread over the jobs.
+void control::Spread(vector<control>& workers, void (control::*work)(void))
+{
+    vector<thread> running;
+    for (unsigned int a = 0; this->jobs > a; a++)
+    {
+        running.push_back(thread([&workers, work, a, this]()
+        {
+            for (size_t b = a; workers.size() > b; b += this->jobs) (workers[b].*work)();
+        }));
+    }
+    for (unsigned int a = 0; this->jobs > a; a++) running[a].join();
+}
+
+// cut the range in shards of ShardRows chapters and give one to every worker.
+// while a round of workers is running, the shards of the previous round are
+// written out in order, so the file is the same as the one Rows() writes.
+void control::Parallel(void)
+{
+    vector<control> workers(2 * this->jobs);
+    vector<thread> running(2 * this->jobs);
+    unsigned int previous = 0, count, base = 0, last = 0;
+
+    for (int round = 0;; round++)
+    {
+        base = (round % 2) * this->jobs;
+        for (count = 0; this->jobs > count && this->end.IsGreaterEqual(this->begin); count++)
+        {
+            control& worker = workers[base + count];
+            worker.out = &worker.shard;
+            worker.begin = this->begin;
+            worker.end = BigInt(this->begin).Add(control::ShardRows - 1);
+            if (worker.end.IsGreater(this->end)) worker.end = this->end;
+            this->begin = BigInt(worker.end).Add(1);
+            running[base + count] = thread(&control::Rows, &worker);
+        }
+
+        for (unsigned int a = 0; previous > a; a++)
+        {
+            running[last + a].join();
+            this->out->Take(workers[last + a].shard);
+        }
+        if (count == 0) break;
+
+        previous = count;
+        last = base;
+    }
+}
+
+// write the Chinese name of the chapter in label.
+// only the passes from the last one that did not look at a changed digit are done again,
+// for most chapters that is the passes over the last group of 4 digits.
+void control::NumberConv(const Counter& chapter)
+{
+    int point, check = (int)chapter.Size();
     bool key = true, flag;
-    string PointNumber, NextNumber, SecNumber;
-    BigNumber reversal = 0;
+    char PointNumber, NextNumber = '\0', SecNumber = '\0';
+    size_t changed = chapter.Changed(), step = 0;
+
+    if (this->reversal.size() != chapter.Size())
+    {
+        this->reversal.resize(chapter.Size());
+        changed = chapter.Size();
+    }
+    for (size_t a = 0; changed > a; a++) this->reversal[a] = chapter.Data()[chapter.Size() - 1 - a];
+    if (this->fake) this->reversal[0] = '1';
+
+    if (changed < chapter.Size() && !this->steps.empty())
+    {
+        step = this->steps.size() - 1;
+        while (step > 0 && changed > this->steps[step].touched) step--;
 
-    while (now.IsUnequal(0))
+        const Step& from = this->steps[step];
+        this->label.resize(from.size);
+        this->low = from.low;
+        this->high = from.high;
+        this->touched = from.touched;
+        this->digits = from.digits;
+        this->ten = from.ten;
+        key = from.key;
+        NextNumber = from.NextNumber;
+        SecNumber = from.SecNumber;
+    }
+    else
     {
-        reversal.Mul(10);
-        reversal.Add(now.Mod(10));
-        now.Div(10).Integer();
-        this->digits++;
+        this->label.clear();
+        this->low = 0;
+        this->high = this->reversal.size();
+        this->touched = this->reversal.size();
+        this->digits = check;
     }
-    check = this->digits;
+    this->steps.resize(step);
 
-    while (reversal.IsUnequal(0))
+    while (this->high > this->low)
     {
+        this->steps.push_back({this->label.size(), this->low, this->high, this->touched, this->digits, key, this->ten, NextNumber, SecNumber});
+
+        // those passes depend on fake, (the units digit).
+        if (check == 2 || this->digits == 3 || this->digits == 4) this->touched = 0;
+
         if (this->fake && check == 2)
         {
-            reversal = reversal.Mod(10);
+            this->Keep(1);
             this->ten = false;
         }
         if (this->fake && this->digits == 3)
         {
-            reversal = reversal.Mod(100);
-            if (reversal.ToInt() == 0) break;
+            this->Keep(2);
+            if (this->high == this->low) break;
+        }
+        if (this->fake && this->digits == 4)
+        {
+            if (this->high - this->low >= 3 && this->reversal.compare(this->high - 3, 3, "000") == 0) break;
         }
-        if (this->fake && this->digits == 4) if (reversal.Mod(1000).ToInt() == 0) break;
-        if(check == 2 && reversal.Mod(10).ToInt() == 1 && digits == 2) this->ten = false;
+        if (check == 2 && this->Last() == 1 && digits == 2) this->ten = false;
 
-        key = this->NumberToChinese(reversal.Mod(10).ToInt(), key);
+        key = this->NumberToChinese(this->Last(), key);
         flag = true;
 
-        PointNumber = reversal.ToString();
         point = this->DigitsConv(false);
 
         if (this->table[point] == this->digits) key = true;
-        if (this->digits % 4 == 3 || this->digits % 4 == 0) NextNumber = PointNumber[this->table[point]];
-        if (this->digits % 4 == 0) SecNumber = PointNumber[this->table[point] + 1];
+        if (this->digits % 4 == 3 || this->digits % 4 == 0) NextNumber = this->PointAt(this->table[point]);
+        if (this->digits % 4 == 0) SecNumber = this->PointAt(this->table[point] + 1);
 
-        PointNumber = PointNumber[this->table[point] - 1];
-        if (this->digits % 4 == 2 && PointNumber == "0")
+        PointNumber = this->PointAt(this->table[point] - 1);
+        if (this->digits % 4 == 2 && PointNumber == '0')
         {
             this->DigitsConv(key);
             this->digits--;
             this->DigitsConv(key);
             flag = false;
-            reversal.Div(100).Integer();
+            this->Drop(2);
             this->digits--;
         }
-        if (this->digits % 4 == 3 && NextNumber == "0" && PointNumber == "0")
+        if (this->digits % 4 == 3 && NextNumber == '0' && PointNumber == '0')
         {
             this->DigitsConv(key);
             this->digits -= 2;
             this->DigitsConv(key);
             flag = false;
-            reversal.Div(1000).Integer();
+            this->Drop(3);
             this->digits--;
         }
-        if (this->digits % 4 == 0 && NextNumber == "0" && SecNumber == "0" && PointNumber == "0")
+        if (this->digits % 4 == 0 && NextNumber == '0' && SecNumber == '0' && PointNumber == '0')
         {
             this->digits -= 3;
-            if (reversal.Mod(10).ToInt() != 0) ux << "千";
+            if (this->Last() != 0) this->label += this->units[3];
             this->DigitsConv(key);
             flag = false;
-            reversal.Div(10000).Integer();
+            this->Drop(4);
             this->digits--;
         }
         if (flag)
         {
             this->DigitsConv(key);
-            reversal.Div(10).Integer();
+            this->Drop(1);
             this->digits--;
         }
         this->ten = true;
@@ -158,109 +657,255 @@ void control::NumberConv(BigNumber now)
 
 bool control::NumberToChinese(int PointNumber, bool key)
 {
-    switch (PointNumber)
+    if (PointNumber == 0)
     {
-    case 0:
-        if (key) ux << "零";
+        if (key) this->label += this->numerals[0];
         return false;
-    case 1:
-        if (this->ten) ux << "一";
-        return true;
-    case 2:
-        ux << "二";
-        return true;
-    case 3:
-        ux << "三";
-        return true;
-    case 4:
-        ux << "四";
-        return true;
-    case 5:
-        ux << "五";
-        return true;
-    case 6:
-        ux << "六";
-        return true;
-    case 7:
-        ux << "七";
-        return true;
-    case 8:
-        ux << "八";
-        return true;
-    case 9:
-        ux << "九";
-        return true;
     }
+    if (PointNumber != 1 || this->ten) this->label += this->numerals[PointNumber];
+    return true;
 }
 
 int control::DigitsConv(bool ComeIn)
 {
-    int compare = 0;
-    while (this->digits > this->table[compare]) compare++;
-    if (this->table[compare] != this->digits) compare--;
+    // every group is 4 digits long, table[compare] is the units digit of the group.
+    // the chapters have at most MaxDigits digits, so compare is always inside table[] and groups[].
+    int compare = (this->digits - 1) / 4;
     if (!ComeIn) return compare;
 
-    if (this->digits - this->table[compare] == 1) ux << "十";
-    else if (this->digits - this->table[compare] == 2) ux << "百";
-    else if (this->digits - this->table[compare] == 3) ux << "千";
-    if (this->digits % 4 == 1)
+    this->label += this->units[this->digits - this->table[compare]];
+    if (this->digits % 4 == 1) this->label += this->groups[compare];
+    return compare;
+}
+
+// the digit the reversal number ends with, (the most significant digit left of the chapter).
+int control::Last(void)
+{
+    if (this->high == this->low) return 0;
+    if (this->touched > this->high - 1) this->touched = this->high - 1;
+    return this->reversal[this->high - 1] - '0';
+}
+
+// the character at the given index of the reversal number as a string.
+char control::PointAt(int index)
+{
+    if (index < 0 || this->low + index >= this->high) return '\0';
+    if (this->touched > this->low + index) this->touched = this->low + index;
+    return this->reversal[this->low + index];
+}
+
+// reversal % 10^count
+void control::Keep(size_t count)
+{
+    this->touched = 0;
+    if (this->high - this->low > count) this->low = this->high - count;
+    while (this->high > this->low && this->reversal[this->low] == '0') this->low++;
+}
+
+// reversal / 10^count
+void control::Drop(size_t count)
+{
+    if (this->high - this->low > count) this->high -= count;
+    else this->high = this->low;
+}
+
+Counter::Counter(const string& number, const string& last)
+{
+    this->last = last;
+    this->digits.assign(last.size() > number.size() ? last.size() : number.size(), '0');
+    this->first = this->digits.size() - number.size();
+    this->digits.replace(this->first, number.size(), number);
+    this->changed = number.size();
+
+    this->same = 0;
+    if (this->Size() == this->last.size()) while (this->last.size() > this->same && this->digits[this->same] == this->last[this->same]) this->same++;
+}
+
+// add one in place, only the digits the carry goes through are touched.
+void Counter::PlusOne(void)
+{
+    size_t a = this->digits.size() - 1;
+    for (this->changed = 1; this->digits[a] == '9' && a > this->first; this->changed++, a--) this->digits[a] = '0';
+
+    if (this->digits[a] == '9')
+    {
+        // 99..9 + 1, one more digit, (there is always room, we never go past the last chapter).
+        this->digits[a] = '0';
+        this->digits[--this->first] = '1';
+        this->changed++;
+        this->same = 0;
+    }
+    else
+    {
+        this->digits[a]++;
+        if (this->same > this->Size() - this->changed) this->same = this->Size() - this->changed;
+    }
+
+    // how many of the first digits are the same as the last chapter, it only needs to be checked
+    // from the first digit that changed.
+    if (this->Size() == this->last.size()) while (this->last.size() > this->same && this->digits[this->same] == this->last[this->same]) this->same++;
+}
+
+bool Counter::IsLast(void) const
+{
+    return this->Size() == this->last.size() && this->same == this->last.size();
+}
+
+// how many of the last digits changed with the last PlusOne, (all of them for a new number).
+size_t Counter::Changed(void) const
+{
+    return this->changed;
+}
+
+size_t Counter::Size(void) const
+{
+    return this->digits.size() - this->first;
+}
+
+const char* Counter::Data(void) const
+{
+    return this->digits.data() + this->first;
+}
+
+char Counter::Back(void) const
+{
+    return this->digits[this->digits.size() - 1];
+}
+
+Buffer::Buffer(void)
+{
+}
+
+Buffer::Buffer(const char* filename, size_t capacity)
+{
+    this->name = filename;
+    // it can only be mapped if it can be read too, (a device might only be written).
+    this->handle = CreateFileA(filename, GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (this->handle == INVALID_HANDLE_VALUE) this->handle = CreateFileA(filename, GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    this->capacity = capacity;
+    this->data.reserve(capacity);
+}
+
+bool Buffer::IsOpen(void) const
+{
+    return this->handle != INVALID_HANDLE_VALUE;
+}
+
+void Buffer::Append(const char* text, size_t size)
+{
+    if (this->IsOpen() && this->data.size() + size > this->capacity)
+    {
+        this->Flush();
+        // too big to be worth copying, (a whole shard), it goes straight to the file.
+        if (size >= this->capacity)
+        {
+            this->Write(text, size);
+            return;
+        }
+    }
+    this->data.append(text, size);
+}
+
+void Buffer::Append(const string& text)
+{
+    this->Append(text.data(), text.size());
+}
+
+// move the rows of another buffer at the end of this one, its memory is kept for the next shard.
+void Buffer::Take(Buffer& other)
+{
+    this->Append(other.data);
+    other.data.clear();
+}
+
+// hand everything we have to the file, the memory is kept for the next block.
+void Buffer::Flush(void)
+{
+    this->Write(this->data.data(), this->data.size());
+    this->data.clear();
+}
+
+// write all of it at the end of the file, (a GB at a time), failed is set if it cannot.
+void Buffer::Write(const char* text, size_t size)
+{
+    while (size > 0 && !this->failed)
+    {
+        DWORD done = 0;
+        if (!WriteFile(this->handle, text, size > (1 << 30) ? (DWORD)(1 << 30) : (DWORD)size, &done, NULL) || done == 0)
+        {
+            this->failed = true;
+            return;
+        }
+        text += done;
+        size -= done;
+        this->written += done;
+    }
+}
+
+size_t Buffer::Size(void) const
+{
+    return this->data.size();
+}
+
+// copy the rows to that memory, (it has to be big enough), the memory is kept for the next shard.
+void Buffer::CopyTo(char* memory)
+{
+    memcpy(memory, this->data.data(), this->data.size());
+    this->data.clear();
+}
+
+// grow the file by size bytes and map them, the returned memory is where those bytes start.
+// only the new part of the file is mapped, (from the allocation granularity it starts in).
+// nullptr if the file cannot be mapped, (a pipe, no space left...), the file is left as it was.
+char* Buffer::Map(size_t size)
+{
+    this->Flush();
+    if (this->failed) return nullptr;
+
+    SYSTEM_INFO system;
+    GetSystemInfo(&system);
+    const size_t granularity = system.dwAllocationGranularity;
+    this->offset = this->written / granularity * granularity;
+    this->length = this->written + size;
+
+    // a mapping bigger than the file grows the file.
+    this->mapping = CreateFileMappingA(this->handle, NULL, PAGE_READWRITE, (DWORD)((unsigned long long)this->length >> 32), (DWORD)this->length, NULL);
+    if (this->mapping != NULL)
     {
-        switch (this->table[compare])
+        void* memory = MapViewOfFile(this->mapping, FILE_MAP_WRITE, (DWORD)((unsigned long long)this->offset >> 32), (DWORD)this->offset, this->length - this->offset);
+        if (memory != NULL)
         {
-        case 5:
-            ux << "萬";
-            return compare;
-        case 9:
-            ux << "億";
-            return compare;
-        case 13:
-            ux << "兆";
-            return compare;
-        case 17:
-            ux << "京";
-            return compare;
-        case 21:
-            ux << "垓";
-            return compare;
-        case 25:
-            ux << "秭";
-            return compare;
-        case 29:
-            ux << "穰";
-            return compare;
-        case 33:
-            ux << "溝";
-            return compare;
-        case 37:
-            ux << "澗";
-            return compare;
-        case 41:
-            ux << "正";
-            return compare;
-        case 45:
-            ux << "戴";
-            return compare;
-        case 49:
-            ux << "極";
-            return compare;
-        case 53:
-            ux << "恆河沙";
-            return compare;
-        case 57:
-            ux << "阿僧祇";
-            return compare;
-        case 61:
-            ux << "那由他";
-            return compare;
-        case 65:
-            ux << "不可思議";
-            return compare;
-        case 69:
-            ux << "無量";
-            return compare;
-        case 73:
-            ux << "大數";
-            return compare;
+            this->mapped = static_cast<char*>(memory);
+            return this->mapped + (this->written - this->offset);
         }
+        CloseHandle(this->mapping);
+        this->mapping = NULL;
+
+        // the file pointer is still where the rows end.
+        if (!SetEndOfFile(this->handle)) cerr << "Error! Cannot restore " << this->name << ".\n";
     }
-}
\ No newline at end of file
+    return nullptr;
+}
+
+// the mapped bytes are all written, the next rows go through the stream again after them.
+void Buffer::Unmap(void)
+{
+    UnmapViewOfFile(this->mapped);
+    CloseHandle(this->mapping);
+    this->mapped = nullptr;
+    this->mapping = NULL;
+    this->written = this->length;
+
+    LARGE_INTEGER end;
+    end.QuadPart = (LONGLONG)this->length;
+    if (!SetFilePointerEx(this->handle, end, NULL, FILE_BEGIN)) this->failed = true;
+}
+
+// false if not all the rows could be written.
+bool Buffer::Close(void)
+{
+    this->Flush();
+    if (!CloseHandle(this->handle)) this->failed = true;
+    this->handle = INVALID_HANDLE_VALUE;
+    return !this->failed;
+}